@@ -6,6 +6,8 @@
 #ifndef OPERATORS_ARROW_HPP
 #define OPERATORS_ARROW_HPP
 
+#include <operators/force_inline.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 import operators.arrow_impl;
@@ -17,8 +19,13 @@ import std_module;
 // We currently cannot have a free-function `operator->`, so the approaches used
 // in the rest of this library cannot apply here.
 
-#define OPERATORS_DETAIL_TEMPLATE_DECLTYPE_EXPRESSION(function, ...) \
-	function<decltype(__VA_ARGS__)>(__VA_ARGS__)
+#define OPERATORS_DETAIL_ADDRESSOF_WRAPPER(...) \
+	::operators::detail::addressof_wrapper<decltype(__VA_ARGS__)>(__VA_ARGS__)
+
+// `arrow_proxy_value` is an aggregate, so a prvalue returned by `operator*`
+// initializes its member directly rather than being moved into it
+#define OPERATORS_DETAIL_ARROW_PROXY_VALUE(...) \
+	::operators::detail::arrow_proxy_value<decltype(__VA_ARGS__)>{__VA_ARGS__}
 
 // It does not seem possible to make `operator->` SFINAE friendly, safe, and
 // work with const return values. If we make it SFINAE friendly and we have a
@@ -30,35 +37,26 @@ import std_module;
 // users will get an error if they return a const value from a function or if
 // they move from a value declared const. Neither of those are the end of the
 // world, but are still unfortunate.
-#define OPERATORS_DETAIL_ARROW_DEFINITIONS_IMPL(self, function) \
+#define OPERATORS_DETAIL_ARROW_DEFINITIONS_IMPL(self, wrap) \
 	template<typename operators_indirect_identity = ::operators::detail::indirect> \
-	constexpr auto operator->() const & OPERATORS_RETURNS( \
-		OPERATORS_DETAIL_TEMPLATE_DECLTYPE_EXPRESSION( \
-			function, \
-			*self(operators_indirect_identity::identity(*this)) \
-		) \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator->() const & OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(arrow, \
+		wrap(*self(operators_indirect_identity::identity(*this))) \
 	) \
 	template<typename operators_indirect_identity = ::operators::detail::indirect> \
-	constexpr auto operator->() & OPERATORS_RETURNS( \
-		OPERATORS_DETAIL_TEMPLATE_DECLTYPE_EXPRESSION( \
-			function, \
-			*self(operators_indirect_identity::identity(*this)) \
-		) \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator->() & OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(arrow, \
+		wrap(*self(operators_indirect_identity::identity(*this))) \
 	) \
 	template<typename operators_indirect_identity = ::operators::detail::indirect> \
-	constexpr auto operator->() && OPERATORS_RETURNS( \
-		OPERATORS_DETAIL_TEMPLATE_DECLTYPE_EXPRESSION( \
-			function, \
-			*self(operators_indirect_identity::identity(std::move(*this))) \
-		) \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator->() && OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(arrow, \
+		wrap(*self(operators_indirect_identity::identity(std::move(*this)))) \
 	) \
 	auto operator->() const && = delete;
 
 #define OPERATORS_DETAIL_ARROW_DEFINITIONS(self) \
-	OPERATORS_DETAIL_ARROW_DEFINITIONS_IMPL(self, ::operators::detail::addressof_wrapper)
+	OPERATORS_DETAIL_ARROW_DEFINITIONS_IMPL(self, OPERATORS_DETAIL_ADDRESSOF_WRAPPER)
 
 #define OPERATORS_DETAIL_ARROW_PROXY_DEFINITIONS(self) \
-	OPERATORS_DETAIL_ARROW_DEFINITIONS_IMPL(self, ::operators::detail::arrow_proxy_value)
+	OPERATORS_DETAIL_ARROW_DEFINITIONS_IMPL(self, OPERATORS_DETAIL_ARROW_PROXY_VALUE)
 
 #define OPERATORS_ARROW_DEFINITIONS \
 	OPERATORS_DETAIL_ARROW_DEFINITIONS(::operators::detail::indirect::identity)
@@ -6,7 +6,9 @@
 #ifndef OPERATORS_BRACKET_HPP
 #define OPERATORS_BRACKET_HPP
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 import operators.bracket_impl;
@@ -21,15 +23,15 @@ import std_module;
 // This must use the full template syntax to avoid a clang crash
 #define OPERATORS_DETAIL_BRACKET_DEFINITIONS(self, function) \
 	template<typename Index> \
-	constexpr auto operator[](Index && index) const & OPERATORS_RETURNS( \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](Index && index) const & OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(bracket, \
 		function(self, OPERATORS_FORWARD(index)) \
 	) \
 	template<typename Index> \
-	constexpr auto operator[](Index && index) & OPERATORS_RETURNS( \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](Index && index) & OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(bracket, \
 		function(self, OPERATORS_FORWARD(index)) \
 	) \
 	template<typename Index> \
-	constexpr auto operator[](Index && index) && OPERATORS_RETURNS( \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](Index && index) && OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(bracket, \
 		function(std::move(self), OPERATORS_FORWARD(index)) \
 	)
 
@@ -39,6 +41,33 @@ import std_module;
 #define OPERATORS_DETAIL_BRACKET_SEQUENCE_RANGE_DEFINITIONS_IMPL(self) \
 	OPERATORS_DETAIL_BRACKET_DEFINITIONS(self, ::operators::detail::sequence_range_operator_bracket)
 
+#if defined(NDEBUG)
+#define OPERATORS_DETAIL_BOUNDS_CHECK(policy) ::operators::detail::resolve_bounds_check(policy, false)
+#else
+#define OPERATORS_DETAIL_BOUNDS_CHECK(policy) ::operators::detail::resolve_bounds_check(policy, true)
+#endif
+
+#define OPERATORS_DETAIL_BRACKET_SEQUENCE_RANGE_DEFINITIONS_WITH_POLICY_IMPL(self, policy) \
+	OPERATORS_DETAIL_BRACKET_DEFINITIONS( \
+		self, \
+		::operators::detail::checked_sequence_range_operator_bracket<OPERATORS_DETAIL_BOUNDS_CHECK(policy)> \
+	)
+
+// The layout is variadic in case it has a comma
+#define OPERATORS_DETAIL_BRACKET_MULTIDIMENSIONAL_DEFINITIONS_IMPL(self, ...) \
+	template<typename... Indices> \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](Indices && ... indices) const & OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(bracket, \
+		::operators::detail::multidimensional_operator_bracket<__VA_ARGS__>(self, OPERATORS_FORWARD(indices)...) \
+	) \
+	template<typename... Indices> \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](Indices && ... indices) & OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(bracket, \
+		::operators::detail::multidimensional_operator_bracket<__VA_ARGS__>(self, OPERATORS_FORWARD(indices)...) \
+	) \
+	template<typename... Indices> \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](Indices && ... indices) && OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(bracket, \
+		::operators::detail::multidimensional_operator_bracket<__VA_ARGS__>(std::move(self), OPERATORS_FORWARD(indices)...) \
+	)
+
 
 #define OPERATORS_BRACKET_ITERATOR_DEFINITIONS \
 	OPERATORS_DETAIL_BRACKET_ITERATOR_DEFINITIONS_IMPL(*this)
@@ -46,4 +75,12 @@ import std_module;
 #define OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS \
 	OPERATORS_DETAIL_BRACKET_SEQUENCE_RANGE_DEFINITIONS_IMPL(*this)
 
+// `policy` is an `operators::bounds_check`
+#define OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS_WITH_POLICY(policy) \
+	OPERATORS_DETAIL_BRACKET_SEQUENCE_RANGE_DEFINITIONS_WITH_POLICY_IMPL(*this, policy)
+
+// The arguments are an `operators::layout`, such as `operators::layout::row_major`
+#define OPERATORS_BRACKET_MULTIDIMENSIONAL_DEFINITIONS(...) \
+	OPERATORS_DETAIL_BRACKET_MULTIDIMENSIONAL_DEFINITIONS_IMPL(*this, __VA_ARGS__)
+
 #endif // OPERATORS_BRACKET_HPP
\ No newline at end of file
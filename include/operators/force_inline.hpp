@@ -0,0 +1,28 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef OPERATORS_FORCE_INLINE_HPP
+#define OPERATORS_FORCE_INLINE_HPP
+
+// Every generated operator is a few layers of forwarding: `x++` calls
+// `postfix_increment_impl`, which calls `++x`, which calls `x += 1`, which
+// calls `x + 1`. An optimizer removes all of them, but unoptimized builds pay
+// for each call. Defining `OPERATORS_FORCE_INLINE` (the CMake option of the
+// same name does this for the `operators` target and everything that links to
+// it) inlines every generated operator and helper regardless of optimization
+// level and marks them as artificial, so a debugger steps over them and into
+// the user's own operators.
+//
+// This is a decl-specifier rather than a standard attribute so it can follow
+// `friend` and `export`.
+#if defined(OPERATORS_FORCE_INLINE) and (defined(__GNUC__) or defined(__clang__))
+#define OPERATORS_DETAIL_FORCE_INLINE __attribute__((always_inline, artificial))
+#elif defined(OPERATORS_FORCE_INLINE) and defined(_MSC_VER)
+#define OPERATORS_DETAIL_FORCE_INLINE __forceinline
+#else
+#define OPERATORS_DETAIL_FORCE_INLINE
+#endif
+
+#endif // OPERATORS_FORCE_INLINE_HPP
@@ -0,0 +1,49 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef OPERATORS_INSTRUMENT_HPP
+#define OPERATORS_INSTRUMENT_HPP
+
+#include <operators/returns.hpp>
+
+// Defining `OPERATORS_INSTRUMENT` (the CMake option of the same name does this
+// for the `operators` target and everything that links to it) makes every
+// generated operator count its calls and the copies and moves it makes in the
+// thread-local counters of `operators.instrument`. Otherwise these expand to
+// exactly what they would be without instrumentation.
+//
+// Only the function body differs, so the signature, return type, and
+// exception specification of an operator do not depend on the mode. Without
+// instrumentation, nothing imports `operators.instrument` and it is not built.
+#if defined(OPERATORS_INSTRUMENT)
+
+import operators.instrument;
+
+#define OPERATORS_DETAIL_RECORD_CALL(name) \
+	::operators::instrument::detail::record_call(::operators::instrument::operation::name)
+#define OPERATORS_DETAIL_RECORD_COPY(name) \
+	::operators::instrument::detail::record_copy(::operators::instrument::operation::name)
+#define OPERATORS_DETAIL_RECORD_MOVE(name) \
+	::operators::instrument::detail::record_move(::operators::instrument::operation::name)
+
+#define OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(name, ...) \
+	noexcept(noexcept(__VA_ARGS__) and OPERATORS_DETAIL_NOTHROW_RETURNABLE(__VA_ARGS__)) \
+	-> decltype(__VA_ARGS__) { \
+		OPERATORS_DETAIL_RECORD_CALL(name); \
+		return __VA_ARGS__; \
+	}
+
+#else
+
+#define OPERATORS_DETAIL_RECORD_CALL(name) static_cast<void>(0)
+#define OPERATORS_DETAIL_RECORD_COPY(name) static_cast<void>(0)
+#define OPERATORS_DETAIL_RECORD_MOVE(name) static_cast<void>(0)
+
+#define OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(name, ...) \
+	OPERATORS_RETURNS_NOEXCEPT(__VA_ARGS__)
+
+#endif
+
+#endif // OPERATORS_INSTRUMENT_HPP
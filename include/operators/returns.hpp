@@ -6,9 +6,31 @@
 #ifndef OPERATORS_RETURNS_HPP
 #define OPERATORS_RETURNS_HPP
 
-// It does not appear to be possible to write a version of this that propagates
-// noexcept because of implicit moves of function parameters in return
-// statements.
+import std_module;
+
 #define OPERATORS_RETURNS(...) -> decltype(__VA_ARGS__) { return __VA_ARGS__; }
 
-#endif // OPERATORS_RETURNS_HPP
\ No newline at end of file
+// `return expression;` constructs the returned object from the expression
+// unless the return type is a reference or the expression is a prvalue. That
+// leaves an unparenthesized id-expression or class member access of
+// non-reference type. It is moved from if it names a function parameter or
+// local variable and copied from otherwise, and there is no way to tell those
+// apart, so this requires that both are non-throwing.
+#define OPERATORS_DETAIL_NOTHROW_RETURNABLE(...) ( \
+	std::is_reference_v<decltype(__VA_ARGS__)> or \
+	!std::is_reference_v<decltype((__VA_ARGS__))> or ( \
+		std::is_nothrow_constructible_v< \
+			decltype(__VA_ARGS__), \
+			std::remove_reference_t<decltype((__VA_ARGS__))> && \
+		> and ( \
+			!std::is_constructible_v<decltype(__VA_ARGS__), decltype((__VA_ARGS__))> or \
+			std::is_nothrow_constructible_v<decltype(__VA_ARGS__), decltype((__VA_ARGS__))> \
+		) \
+	) \
+)
+
+#define OPERATORS_RETURNS_NOEXCEPT(...) \
+	noexcept(noexcept(__VA_ARGS__) and OPERATORS_DETAIL_NOTHROW_RETURNABLE(__VA_ARGS__)) \
+	OPERATORS_RETURNS(__VA_ARGS__)
+
+#endif // OPERATORS_RETURNS_HPP
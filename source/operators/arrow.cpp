@@ -40,7 +40,7 @@ constexpr auto && as_ref_ref(auto && value) {
 }
 
 template<typename T>
-T declval();
+T declval() noexcept;
 
 template<typename T>
 concept has_operator_arrow = requires { declval<T>().operator->(); };
@@ -81,6 +81,7 @@ static_assert(as_ref(macro_ref(5))->value == 15);
 static_assert(as_ref_ref(macro_ref(5))->value == 25);
 static_assert(has_operator_arrow<macro_ref &&>);
 static_assert(has_operator_arrow<macro_ref>);
+static_assert(!noexcept(declval<macro_ref &>().operator->()));
 
 
 struct macro_ref_proxy {
@@ -196,14 +197,14 @@ struct crtp_ref_proxy : operators::arrow_proxy<crtp_ref_proxy> {
 	{
 	}
 
-	constexpr auto const & operator*() const & {
+	constexpr auto const & operator*() const & noexcept {
 		return value;
 	}
-	constexpr auto & operator*() & {
+	constexpr auto & operator*() & noexcept {
 		value = wrapper{value.value + 10};
 		return value;
 	}
-	constexpr auto && operator*() && {
+	constexpr auto && operator*() && noexcept {
 		value = wrapper{value.value + 20};
 		return std::move(value);
 	}
@@ -216,6 +217,9 @@ static_assert(as_const_ref(crtp_ref_proxy(5))->value == 5);
 static_assert(as_ref(crtp_ref_proxy(5))->value == 15);
 static_assert(as_ref_ref(crtp_ref_proxy(5))->value == 25);
 static_assert(crtp_ref_proxy(5)->value == 25);
+static_assert(noexcept(declval<crtp_ref_proxy const &>().operator->()));
+static_assert(noexcept(declval<crtp_ref_proxy &>().operator->()));
+static_assert(noexcept(declval<crtp_ref_proxy>().operator->()));
 
 
 
@@ -270,4 +274,64 @@ static_assert(as_ref(crtp_value_proxy(5))->value == 15);
 static_assert(as_ref_ref(crtp_value_proxy(5))->value == 25);
 static_assert(crtp_value_proxy(5)->value == 25);
 
+
+// The proxy holds the value returned by `operator*` without moving it
+struct immovable {
+	constexpr explicit immovable(int value_):
+		value(value_)
+	{
+	}
+	immovable(immovable &&) = delete;
+	immovable(immovable const &) = delete;
+
+	int value;
+};
+
+struct immovable_proxy : operators::arrow_proxy<immovable_proxy> {
+	constexpr auto operator*() const {
+		return immovable(5);
+	}
+};
+
+static_assert(immovable_proxy()->value == 5);
+static_assert(as_ref(immovable_proxy())->value == 5);
+
+
+struct counts_moves {
+	constexpr explicit counts_moves(int & moves_):
+		moves(moves_)
+	{
+	}
+	constexpr counts_moves(counts_moves && other):
+		moves(other.moves)
+	{
+		++moves;
+	}
+
+	int & moves;
+};
+
+struct counts_moves_proxy {
+	constexpr explicit counts_moves_proxy(int & moves_):
+		moves(moves_)
+	{
+	}
+
+	constexpr auto operator*() const {
+		return counts_moves(moves);
+	}
+
+	OPERATORS_ARROW_PROXY_DEFINITIONS
+
+private:
+	int & moves;
+};
+
+constexpr auto moves_for_arrow() -> int {
+	auto moves = 0;
+	auto const proxy = counts_moves_proxy(moves);
+	return proxy->moves;
+}
+static_assert(moves_for_arrow() == 0);
+
 } // namespace
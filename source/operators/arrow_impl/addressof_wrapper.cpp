@@ -3,6 +3,10 @@
 // (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+module;
+
+#include <operators/force_inline.hpp>
+
 export module operators.arrow_impl.addressof_wrapper;
 
 import std_module;
@@ -11,7 +15,7 @@ namespace operators::detail {
 
 // This works on rvalue references
 export template<typename T> requires std::is_reference_v<T>
-constexpr auto addressof_wrapper(auto && object) noexcept {
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto addressof_wrapper(auto && object) noexcept {
 	return ::std::addressof(object);
 }
 
@@ -5,7 +5,7 @@
 
 module;
 
-#include <operators/forward.hpp>
+#include <operators/force_inline.hpp>
 
 export module operators.arrow_impl.arrow_proxy_value;
 
@@ -13,17 +13,15 @@ import std_module;
 
 namespace operators::detail {
 
+// An aggregate rather than a class with a constructor so that
+// `arrow_proxy_value<T>{*it}` constructs `value` in place from the prvalue
+// returned by `operator*`, even if `T` cannot be moved
 export template<typename T>
 struct arrow_proxy_value {
-	constexpr explicit arrow_proxy_value(T value_):
-		value(OPERATORS_FORWARD(value_))
-	{
-	}
-	constexpr auto operator->() && {
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator->() && noexcept {
 		return std::addressof(value);
 	}
 
-private:
 	T value;
 };
 
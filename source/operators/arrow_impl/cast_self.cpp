@@ -3,20 +3,24 @@
 // (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+module;
+
+#include <operators/force_inline.hpp>
+
 export module operators.arrow_impl.cast_self;
 
 namespace operators::detail {
 
 export template<typename T>
-constexpr auto cast_self(auto const & self) -> T const & {
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto cast_self(auto const & self) noexcept -> T const & {
 	return static_cast<T const &>(self);
 }
 export template<typename T>
-constexpr auto cast_self(auto & self) -> T & {
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto cast_self(auto & self) noexcept -> T & {
 	return static_cast<T &>(self);
 }
 export template<typename T>
-constexpr auto cast_self(auto && self) -> T && {
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto cast_self(auto && self) noexcept -> T && {
 	return static_cast<T &&>(self);
 }
 
@@ -5,6 +5,7 @@
 
 module;
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
 
 export module operators.arrow_impl.indirect;
@@ -18,7 +19,7 @@ namespace operators::detail {
 // defined with a deduced return type.
 export struct indirect {
 	template<typename T>
-	static constexpr auto identity(T && value) -> T && {
+	static OPERATORS_DETAIL_FORCE_INLINE constexpr auto identity(T && value) noexcept -> T && {
 		return value;
 	}
 };
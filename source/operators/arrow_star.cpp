@@ -5,7 +5,9 @@
 
 module;
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 export module operators.arrow_star;
@@ -13,7 +15,7 @@ export module operators.arrow_star;
 import std_module;
 
 #define OPERATORS_ARROW_STAR_DEFINITION \
-	constexpr auto operator->*(auto && lhs, auto && rhs) OPERATORS_RETURNS( \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator->*(auto && lhs, auto && rhs) OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(arrow_star, \
 		(*OPERATORS_FORWARD(lhs)).*OPERATORS_FORWARD(rhs) \
 	)
 
@@ -60,6 +62,7 @@ private:
 };
 
 static_assert(adl(3)->*member == 3);
+static_assert(!noexcept(std::declval<adl const &>()->*member));
 
 namespace n {
 
@@ -70,7 +73,7 @@ struct implicit {
 		value(value_)
 	{
 	}
-	constexpr auto const & operator*() const {
+	constexpr auto const & operator*() const noexcept {
 		return value;
 	}
 
@@ -83,5 +86,6 @@ static_assert(implicit(3)->*member == 3);
 } // namespace n
 
 static_assert(n::implicit(3)->*member == 3);
+static_assert(noexcept(std::declval<n::implicit const &>()->*member));
 
 } // namespace
@@ -0,0 +1,119 @@
+# Copyright David Stone 2026.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# Usage: cmake -DOBJDUMP=<objdump> -DGENERATED=<object> -DMANUAL=<object> -P compare.cmake
+#
+# Disassembles both object files and compares every function whose name starts
+# with `operators_parity_`. The test fails if a function is missing from either
+# file, if the number of instructions differs, or if the number of calls
+# differs.
+
+cmake_minimum_required(VERSION 3.28 FATAL_ERROR)
+
+foreach(variable OBJDUMP GENERATED MANUAL)
+	if (NOT DEFINED ${variable})
+		message(FATAL_ERROR "${variable} must be defined")
+	endif()
+endforeach()
+
+# Sets `${prefix}_functions` to the list of compared function names, and for
+# each function `${prefix}_<name>_instructions`, `${prefix}_<name>_calls`, and
+# `${prefix}_<name>_listing`.
+function(disassemble object prefix)
+	execute_process(
+		COMMAND "${OBJDUMP}" --disassemble --reloc --no-show-raw-insn "${object}"
+		OUTPUT_VARIABLE output
+		ERROR_VARIABLE error
+		RESULT_VARIABLE result
+	)
+	if (NOT result EQUAL 0)
+		message(FATAL_ERROR "${OBJDUMP} failed on ${object}:\n${error}")
+	endif()
+	# Semicolons would split lines into separate list elements
+	string(REPLACE ";" "," output "${output}")
+	string(REPLACE "\n" ";" lines "${output}")
+
+	set(functions)
+	set(current)
+	foreach(line IN LISTS lines)
+		if (line MATCHES "^[0-9a-fA-F]+ <(.*)>:$")
+			set(current)
+			# Some platforms prefix C names with an underscore
+			string(REGEX REPLACE "^_" "" name "${CMAKE_MATCH_1}")
+			if (name MATCHES "^operators_parity_")
+				set(current "${name}")
+				list(APPEND functions "${current}")
+				set(${current}_instructions 0)
+				set(${current}_calls 0)
+				set(${current}_listing)
+			endif()
+		elseif (current AND line MATCHES "^ +[0-9a-fA-F]+:\t")
+			string(APPEND ${current}_listing "${line}\n")
+			set(previous_is_jump OFF)
+			# Alignment padding between functions
+			if (line MATCHES "\t((data16|cs|rex[.A-Z]*) )*(nop|xchg +%ax,%ax|int3)")
+				continue()
+			endif()
+			math(EXPR ${current}_instructions "${${current}_instructions} + 1")
+			if (line MATCHES "\t(call|callq|bl|blr|blx|jalr)[ \t]")
+				math(EXPR ${current}_calls "${${current}_calls} + 1")
+			elseif (line MATCHES "\t(j[a-z]+|b|b\\.[a-z]+|cbn?z|tbn?z)[ \t]")
+				# Unconditional and conditional jumps: `jmp`, `jne`, `b`, `b.ne`,
+				# `cbz`, `tbnz`, and so on
+				set(previous_is_jump ON)
+			endif()
+		elseif (current AND line MATCHES "^\t+[0-9a-fA-F]+: R_")
+			# A relocated jump leaves the function, so it is a tail call, whether
+			# or not it is conditional
+			string(APPEND ${current}_listing "${line}\n")
+			if (previous_is_jump)
+				math(EXPR ${current}_calls "${${current}_calls} + 1")
+			endif()
+		endif()
+	endforeach()
+
+	set(${prefix}_functions "${functions}" PARENT_SCOPE)
+	foreach(function IN LISTS functions)
+		foreach(suffix instructions calls listing)
+			set(${prefix}_${function}_${suffix} "${${function}_${suffix}}" PARENT_SCOPE)
+		endforeach()
+	endforeach()
+endfunction()
+
+disassemble("${GENERATED}" generated)
+disassemble("${MANUAL}" manual)
+
+if (NOT generated_functions)
+	message(FATAL_ERROR "No operators_parity_ functions found in ${GENERATED}")
+endif()
+
+set(all_functions ${generated_functions} ${manual_functions})
+list(REMOVE_DUPLICATES all_functions)
+list(SORT all_functions)
+
+set(failures 0)
+foreach(function IN LISTS all_functions)
+	if (NOT function IN_LIST generated_functions OR NOT function IN_LIST manual_functions)
+		message(SEND_ERROR "${function} is not defined in both files")
+		math(EXPR failures "${failures} + 1")
+		continue()
+	endif()
+	set(generated "${generated_${function}_instructions} instructions, ${generated_${function}_calls} calls")
+	set(manual "${manual_${function}_instructions} instructions, ${manual_${function}_calls} calls")
+	if (generated STREQUAL manual)
+		message(STATUS "${function}: ${generated}")
+	else()
+		message(SEND_ERROR
+			"${function}: generated has ${generated}, manual has ${manual}\n"
+			"generated:\n${generated_${function}_listing}"
+			"manual:\n${manual_${function}_listing}"
+		)
+		math(EXPR failures "${failures} + 1")
+	endif()
+endforeach()
+
+if (failures GREATER 0)
+	message(FATAL_ERROR "${failures} functions differ between generated and hand-written operators")
+endif()
@@ -0,0 +1,150 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Every function in this file must compile to the same instructions as the
+// function with the same name in manual.cpp. See compare.cmake.
+
+#include <operators/arrow.hpp>
+#include <operators/bracket.hpp>
+
+import operators;
+import std_module;
+
+namespace {
+
+struct integer : private operators::compound_assignment, private operators::increment_decrement {
+	constexpr explicit integer(int const value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto operator+(integer const lhs, integer const rhs) -> integer {
+		return integer(lhs.value + rhs.value);
+	}
+	friend constexpr auto operator+(integer const lhs, int const rhs) -> integer {
+		return integer(lhs.value + rhs);
+	}
+	friend constexpr auto operator-(integer const lhs, integer const rhs) -> integer {
+		return integer(lhs.value - rhs.value);
+	}
+	friend constexpr auto operator-(integer const lhs, int const rhs) -> integer {
+		return integer(lhs.value - rhs);
+	}
+	friend constexpr auto operator*(integer const lhs, integer const rhs) -> integer {
+		return integer(lhs.value * rhs.value);
+	}
+
+	int value;
+};
+
+// Refers to a string owned by the caller. Appending is done in place by
+// `add_in_place`, so `+=` never builds a new string.
+struct text : private operators::compound_assignment {
+	constexpr explicit text(std::string & value_):
+		value(std::addressof(value_))
+	{
+	}
+	friend auto add_in_place(text & lhs, std::string const & rhs) -> void {
+		lhs.value->append(rhs);
+	}
+
+private:
+	std::string * value;
+};
+
+struct string_pointer {
+	constexpr explicit string_pointer(std::string * pointer_):
+		pointer(pointer_)
+	{
+	}
+	constexpr auto operator*() const -> std::string & {
+		return *pointer;
+	}
+
+	OPERATORS_ARROW_DEFINITIONS
+
+private:
+	std::string * pointer;
+};
+
+struct iterator {
+	constexpr explicit iterator(int const * pointer_):
+		pointer(pointer_)
+	{
+	}
+	constexpr auto operator*() const -> int const & {
+		return *pointer;
+	}
+	friend constexpr auto operator+(iterator const lhs, std::ptrdiff_t const rhs) -> iterator {
+		return iterator(lhs.pointer + rhs);
+	}
+
+	OPERATORS_BRACKET_ITERATOR_DEFINITIONS
+
+private:
+	int const * pointer;
+};
+
+} // namespace
+
+extern "C" {
+
+auto operators_parity_plus_equal(int * const lhs, int const rhs) -> void {
+	auto value = integer(*lhs);
+	value += integer(rhs);
+	*lhs = value.value;
+}
+
+auto operators_parity_minus_equal(int * const lhs, int const rhs) -> void {
+	auto value = integer(*lhs);
+	value -= integer(rhs);
+	*lhs = value.value;
+}
+
+auto operators_parity_times_equal(int * const lhs, int const rhs) -> void {
+	auto value = integer(*lhs);
+	value *= integer(rhs);
+	*lhs = value.value;
+}
+
+auto operators_parity_prefix_increment(int * const operand) -> void {
+	auto value = integer(*operand);
+	++value;
+	*operand = value.value;
+}
+
+auto operators_parity_prefix_decrement(int * const operand) -> void {
+	auto value = integer(*operand);
+	--value;
+	*operand = value.value;
+}
+
+auto operators_parity_postfix_increment(int * const operand) -> int {
+	auto value = integer(*operand);
+	auto const original = value++;
+	*operand = value.value;
+	return original.value;
+}
+
+auto operators_parity_postfix_decrement(int * const operand) -> int {
+	auto value = integer(*operand);
+	auto const original = value--;
+	*operand = value.value;
+	return original.value;
+}
+
+auto operators_parity_string_plus_equal(std::string * const lhs, std::string const * const rhs) -> void {
+	auto value = text(*lhs);
+	value += *rhs;
+}
+
+auto operators_parity_arrow(std::string * const pointer) -> std::size_t {
+	return string_pointer(pointer)->size();
+}
+
+auto operators_parity_bracket(int const * const pointer, std::ptrdiff_t const index) -> int {
+	return iterator(pointer)[index];
+}
+
+} // extern "C"
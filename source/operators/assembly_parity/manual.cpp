@@ -0,0 +1,154 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// The hand-written equivalents of the types in generated.cpp. Every function
+// in this file must compile to the same instructions as the function with the
+// same name in generated.cpp. See compare.cmake.
+
+import std_module;
+
+namespace {
+
+struct integer {
+	constexpr explicit integer(int const value_):
+		value(value_)
+	{
+	}
+	constexpr auto operator+=(integer const rhs) -> integer & {
+		value += rhs.value;
+		return *this;
+	}
+	constexpr auto operator-=(integer const rhs) -> integer & {
+		value -= rhs.value;
+		return *this;
+	}
+	constexpr auto operator*=(integer const rhs) -> integer & {
+		value *= rhs.value;
+		return *this;
+	}
+	constexpr auto operator++() -> integer & {
+		++value;
+		return *this;
+	}
+	constexpr auto operator--() -> integer & {
+		--value;
+		return *this;
+	}
+	constexpr auto operator++(int) -> integer {
+		auto const original = *this;
+		++*this;
+		return original;
+	}
+	constexpr auto operator--(int) -> integer {
+		auto const original = *this;
+		--*this;
+		return original;
+	}
+
+	int value;
+};
+
+struct text {
+	constexpr explicit text(std::string & value_):
+		value(std::addressof(value_))
+	{
+	}
+	auto operator+=(std::string const & rhs) -> text & {
+		value->append(rhs);
+		return *this;
+	}
+
+private:
+	std::string * value;
+};
+
+struct string_pointer {
+	constexpr explicit string_pointer(std::string * pointer_):
+		pointer(pointer_)
+	{
+	}
+	constexpr auto operator->() const -> std::string * {
+		return pointer;
+	}
+
+private:
+	std::string * pointer;
+};
+
+struct iterator {
+	constexpr explicit iterator(int const * pointer_):
+		pointer(pointer_)
+	{
+	}
+	constexpr auto operator[](std::ptrdiff_t const index) const -> int const & {
+		return pointer[index];
+	}
+
+private:
+	int const * pointer;
+};
+
+} // namespace
+
+extern "C" {
+
+auto operators_parity_plus_equal(int * const lhs, int const rhs) -> void {
+	auto value = integer(*lhs);
+	value += integer(rhs);
+	*lhs = value.value;
+}
+
+auto operators_parity_minus_equal(int * const lhs, int const rhs) -> void {
+	auto value = integer(*lhs);
+	value -= integer(rhs);
+	*lhs = value.value;
+}
+
+auto operators_parity_times_equal(int * const lhs, int const rhs) -> void {
+	auto value = integer(*lhs);
+	value *= integer(rhs);
+	*lhs = value.value;
+}
+
+auto operators_parity_prefix_increment(int * const operand) -> void {
+	auto value = integer(*operand);
+	++value;
+	*operand = value.value;
+}
+
+auto operators_parity_prefix_decrement(int * const operand) -> void {
+	auto value = integer(*operand);
+	--value;
+	*operand = value.value;
+}
+
+auto operators_parity_postfix_increment(int * const operand) -> int {
+	auto value = integer(*operand);
+	auto const original = value++;
+	*operand = value.value;
+	return original.value;
+}
+
+auto operators_parity_postfix_decrement(int * const operand) -> int {
+	auto value = integer(*operand);
+	auto const original = value--;
+	*operand = value.value;
+	return original.value;
+}
+
+auto operators_parity_string_plus_equal(std::string * const lhs, std::string const * const rhs) -> void {
+	auto value = text(*lhs);
+	value += *rhs;
+}
+
+auto operators_parity_arrow(std::string * const pointer) -> std::size_t {
+	return string_pointer(pointer)->size();
+}
+
+auto operators_parity_bracket(int const * const pointer, std::ptrdiff_t const index) -> int {
+	return iterator(pointer)[index];
+}
+
+} // extern "C"
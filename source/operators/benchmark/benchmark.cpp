@@ -0,0 +1,1417 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares each generated operator against the operator a user would write by
+// hand. Every workload defines a `generated` type that gets its operators from
+// this library and a `manual` type that defines the same operators directly;
+// the two should run at the same speed.
+//
+// Usage: operators_benchmark [iterations [repetitions]]
+
+#include <operators/arrow.hpp>
+#include <operators/bracket.hpp>
+
+import operators;
+import operators.benchmark.harness;
+import operators.parallel;
+import std_module;
+
+namespace {
+
+using operators::benchmark::do_not_optimize;
+using operators::benchmark::harness;
+
+// What some workloads do other than take time, such as allocate, so that they
+// can report it alongside the time with `harness::count`
+namespace counting {
+
+struct counts {
+	std::size_t allocations = 0;
+	std::size_t moves = 0;
+	std::size_t bytes = 0;
+};
+auto counted = counts();
+
+template<typename T>
+struct allocator {
+	using value_type = T;
+
+	allocator() = default;
+	template<typename U>
+	constexpr allocator(allocator<U>) noexcept {
+	}
+
+	auto allocate(std::size_t const size) -> T * {
+		++counted.allocations;
+		return std::allocator<T>().allocate(size);
+	}
+	auto deallocate(T * const pointer, std::size_t const size) -> void {
+		std::allocator<T>().deallocate(pointer, size);
+	}
+
+	friend auto operator==(allocator, allocator) -> bool = default;
+};
+
+} // namespace counting
+
+namespace strong_int {
+
+struct generated : private operators::compound_assignment, private operators::increment_decrement {
+	constexpr explicit generated(int const value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto operator+(generated const lhs, generated const rhs) -> generated {
+		return generated(lhs.value + rhs.value);
+	}
+	friend constexpr auto operator+(generated const lhs, int const rhs) -> generated {
+		return generated(lhs.value + rhs);
+	}
+
+	int value;
+};
+
+struct manual {
+	constexpr explicit manual(int const value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto operator+(manual const lhs, manual const rhs) -> manual {
+		return manual(lhs.value + rhs.value);
+	}
+	constexpr auto operator+=(manual const rhs) -> manual & {
+		value += rhs.value;
+		return *this;
+	}
+	constexpr auto operator++() -> manual & {
+		++value;
+		return *this;
+	}
+	constexpr auto operator++(int) -> manual {
+		auto const original = *this;
+		++*this;
+		return original;
+	}
+
+	int value;
+};
+
+} // namespace strong_int
+
+namespace bigint {
+
+// An unsigned integer of arbitrary size stored as base 2^32 limbs, least
+// significant first. Adding to an rvalue reuses its allocation.
+using limbs = std::vector<std::uint32_t>;
+
+auto add(limbs & lhs, std::span<std::uint32_t const> const rhs) -> void {
+	if (lhs.size() < rhs.size()) {
+		lhs.resize(rhs.size());
+	}
+	auto carry = std::uint64_t(0);
+	for (std::size_t index = 0; index != lhs.size(); ++index) {
+		auto const sum = carry + lhs[index] + (index < rhs.size() ? rhs[index] : 0U);
+		lhs[index] = static_cast<std::uint32_t>(sum);
+		carry = sum >> 32U;
+		if (carry == 0 and index >= rhs.size()) {
+			return;
+		}
+	}
+	if (carry != 0) {
+		lhs.push_back(static_cast<std::uint32_t>(carry));
+	}
+}
+
+struct generated : private operators::compound_assignment, private operators::increment_decrement {
+	explicit generated(limbs value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(generated lhs, generated const & rhs) -> generated {
+		add(lhs.value, rhs.value);
+		return lhs;
+	}
+	friend auto operator+(generated lhs, std::uint32_t const rhs) -> generated {
+		add(lhs.value, std::span(std::addressof(rhs), 1));
+		return lhs;
+	}
+
+	limbs value;
+};
+
+struct manual {
+	explicit manual(limbs value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(manual lhs, manual const & rhs) -> manual {
+		lhs += rhs;
+		return lhs;
+	}
+	auto operator+=(manual const & rhs) -> manual & {
+		add(value, rhs.value);
+		return *this;
+	}
+	auto operator++() -> manual & {
+		auto const one = std::uint32_t(1);
+		add(value, std::span(std::addressof(one), 1));
+		return *this;
+	}
+	auto operator++(int) -> manual {
+		auto original = *this;
+		++*this;
+		return original;
+	}
+
+	limbs value;
+};
+
+// `generated`, except that postfix `++` returns `void` rather than a copy of
+// the previous value. See the specialization of `postfix_return_policy` below.
+struct generated_postfix_none : private operators::compound_assignment, private operators::increment_decrement {
+	explicit generated_postfix_none(limbs value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(generated_postfix_none lhs, std::uint32_t const rhs) -> generated_postfix_none {
+		add(lhs.value, std::span(std::addressof(rhs), 1));
+		return lhs;
+	}
+
+	limbs value;
+};
+
+} // namespace bigint
+
+namespace dense {
+
+// A vector of `double`. Subtracting through `-rhs` allocates a negated copy of
+// `rhs` and adds it, but accepting `operators::negated` subtracts in place.
+using values = std::vector<double, counting::allocator<double>>;
+
+constexpr auto size = std::size_t(1024);
+
+template<typename T>
+auto add(T lhs, T const & rhs) -> T {
+	for (std::size_t index = 0; index != lhs.value.size(); ++index) {
+		lhs.value[index] += rhs.value[index];
+	}
+	return lhs;
+}
+
+template<typename T>
+auto subtract(T lhs, T const & rhs) -> T {
+	for (std::size_t index = 0; index != lhs.value.size(); ++index) {
+		lhs.value[index] -= rhs.value[index];
+	}
+	return lhs;
+}
+
+template<typename T>
+auto negate(T const & value) -> T {
+	auto result = value;
+	for (auto & element : result.value) {
+		element = -element;
+	}
+	return result;
+}
+
+struct generated : operators::binary::minus {
+	explicit generated(values value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(generated lhs, generated const & rhs) -> generated {
+		return add(std::move(lhs), rhs);
+	}
+	friend auto operator+(generated lhs, operators::negated<generated const &> const rhs) -> generated {
+		return subtract(std::move(lhs), rhs.value);
+	}
+	friend auto operator-(generated const & value) -> generated {
+		return negate(value);
+	}
+
+	values value;
+};
+
+struct generated_without_negated : operators::binary::minus {
+	explicit generated_without_negated(values value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(generated_without_negated lhs, generated_without_negated const & rhs) -> generated_without_negated {
+		return add(std::move(lhs), rhs);
+	}
+	friend auto operator-(generated_without_negated const & value) -> generated_without_negated {
+		return negate(value);
+	}
+
+	values value;
+};
+
+struct manual {
+	explicit manual(values value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator-(manual lhs, manual const & rhs) -> manual {
+		return subtract(std::move(lhs), rhs);
+	}
+
+	values value;
+};
+
+} // namespace dense
+
+namespace fused {
+
+// Vectors of `double` that compute `a += b * c - d`. The sizes fit in the L1
+// cache, fit in the L2 or L3 cache, and fit in neither.
+constexpr auto sizes = std::array{std::size_t(1024), std::size_t(65536), std::size_t(4194304)};
+
+// A `double` that counts the bytes read from it and written to it, so that the
+// workload can report how much memory each implementation touches. A
+// value-initialized element is written as zero, as a `double` in a
+// `std::vector` is.
+struct counted_double {
+	counted_double():
+		counted_double(0.0)
+	{
+	}
+	counted_double(double const value_):
+		value(value_)
+	{
+		counting::counted.bytes += sizeof(double);
+	}
+	counted_double(counted_double const & other):
+		counted_double(static_cast<double>(other))
+	{
+	}
+	auto operator=(counted_double const & other) & -> counted_double & {
+		return *this = static_cast<double>(other);
+	}
+	auto operator=(double const value_) & -> counted_double & {
+		counting::counted.bytes += sizeof(double);
+		value = value_;
+		return *this;
+	}
+	auto operator+=(double const rhs) & -> counted_double & {
+		return *this = *this + rhs;
+	}
+	auto operator-=(double const rhs) & -> counted_double & {
+		return *this = *this - rhs;
+	}
+
+	operator double() const {
+		counting::counted.bytes += sizeof(double);
+		return value;
+	}
+
+private:
+	double value;
+};
+
+template<typename Derived, typename Element>
+struct vector_base {
+	using values = std::vector<Element>;
+
+	explicit vector_base(values value_):
+		value(std::move(value_))
+	{
+	}
+	auto operator[](std::size_t const index) const -> Element const & {
+		return value[index];
+	}
+	auto operator[](std::size_t const index) -> Element & {
+		return value[index];
+	}
+	auto size() const -> std::size_t {
+		return value.size();
+	}
+
+	values value;
+};
+
+template<typename Element>
+struct generated : vector_base<generated<Element>, Element>, operators::expression<generated<Element>> {
+	using generated::vector_base::vector_base;
+};
+
+// Each operator computes its whole result before the next one starts, as the
+// dense types did before `operators::expression`
+template<typename Element>
+struct manual : vector_base<manual<Element>, Element> {
+	using manual::vector_base::vector_base;
+
+	friend auto operator+=(manual & lhs, manual const & rhs) -> manual & {
+		for (std::size_t index = 0; index != lhs.size(); ++index) {
+			lhs[index] += rhs[index];
+		}
+		return lhs;
+	}
+	friend auto operator-(manual lhs, manual const & rhs) -> manual {
+		for (std::size_t index = 0; index != lhs.size(); ++index) {
+			lhs[index] -= rhs[index];
+		}
+		return lhs;
+	}
+	friend auto operator*(manual const & lhs, manual const & rhs) -> manual {
+		auto result = manual(typename manual::values(lhs.size()));
+		for (std::size_t index = 0; index != lhs.size(); ++index) {
+			result[index] = lhs[index] * rhs[index];
+		}
+		return result;
+	}
+};
+
+} // namespace fused
+
+namespace numeric {
+
+// Contiguous arrays of numbers small enough to stay in the L1 cache, so the
+// time is spent on arithmetic rather than waiting for memory
+constexpr auto size = std::size_t(4096);
+
+template<typename T>
+struct generated : operators::elementwise<generated<T>> {
+	explicit generated(std::vector<T> value_):
+		value(std::move(value_))
+	{
+	}
+	auto data() -> T * {
+		return value.data();
+	}
+	auto data() const -> T const * {
+		return value.data();
+	}
+	auto size() const -> std::size_t {
+		return value.size();
+	}
+
+	std::vector<T> value;
+};
+
+template<typename T>
+struct manual {
+	explicit manual(std::vector<T> value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+=(manual & lhs, manual const & rhs) -> manual & {
+		for (std::size_t index = 0; index != lhs.value.size(); ++index) {
+			lhs.value[index] += rhs.value[index];
+		}
+		return lhs;
+	}
+	friend auto operator+=(manual & lhs, T const rhs) -> manual & {
+		for (auto & element : lhs.value) {
+			element += rhs;
+		}
+		return lhs;
+	}
+
+	std::vector<T> value;
+};
+
+} // namespace numeric
+
+namespace wide {
+
+// A 256-bit unsigned integer stored as base 2^32 limbs, least significant
+// first. Multiplying by a runtime value multiplies every limb, but multiplying
+// by an `operators::constant` power of two shifts instead.
+using limbs = std::array<std::uint32_t, 8>;
+
+struct generated : private operators::compound_assignment {
+	constexpr explicit generated(limbs const value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto operator*(generated lhs, std::uint32_t const rhs) -> generated {
+		auto carry = std::uint64_t(0);
+		for (auto & limb : lhs.value) {
+			auto const product = std::uint64_t(limb) * rhs + carry;
+			limb = static_cast<std::uint32_t>(product);
+			carry = product >> 32U;
+		}
+		return lhs;
+	}
+	template<auto rhs> requires(std::has_single_bit(static_cast<std::uint32_t>(rhs)) and rhs != 1)
+	friend constexpr auto operator*(generated lhs, operators::constant<rhs>) -> generated {
+		constexpr auto shift = static_cast<std::uint32_t>(std::countr_zero(static_cast<std::uint32_t>(rhs)));
+		for (auto index = lhs.value.size() - 1; index != 0; --index) {
+			lhs.value[index] = (lhs.value[index] << shift) | (lhs.value[index - 1] >> (32U - shift));
+		}
+		lhs.value[0] <<= shift;
+		return lhs;
+	}
+
+	limbs value;
+};
+
+} // namespace wide
+
+} // namespace
+
+template<>
+inline constexpr auto operators::postfix_return_policy<bigint::generated_postfix_none> = operators::postfix_return::none;
+
+namespace {
+
+namespace text {
+
+using base_string = std::basic_string<char, std::char_traits<char>, counting::allocator<char>>;
+
+struct string : base_string {
+	using base_string::base_string;
+	string(string const &) = default;
+	string(string && other) noexcept:
+		base_string(std::move(other))
+	{
+		++counting::counted.moves;
+	}
+	auto operator=(string const &) -> string & = default;
+	auto operator=(string && other) noexcept -> string & {
+		base_string::operator=(std::move(other));
+		++counting::counted.moves;
+		return *this;
+	}
+};
+
+// `lhs = std::move(lhs) + rhs` reuses the allocation of `lhs`, but moves the
+// string into the parameter of `+`, out of it, and back into `lhs`.
+struct generated : private operators::compound_assignment {
+	explicit generated(string value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(generated lhs, generated const & rhs) -> generated {
+		lhs.value.append(rhs.value);
+		return lhs;
+	}
+
+	string value;
+};
+
+// `+` builds its result in a new allocation, as many types that own memory do,
+// so `lhs = std::move(lhs) + rhs` also allocates.
+struct generated_allocating : private operators::compound_assignment {
+	explicit generated_allocating(string value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(generated_allocating const & lhs, generated_allocating const & rhs) -> generated_allocating {
+		auto result = string();
+		result.reserve(lhs.value.size() + rhs.value.size());
+		result.append(lhs.value);
+		result.append(rhs.value);
+		return generated_allocating(std::move(result));
+	}
+
+	string value;
+};
+
+// Either of the types above with `add_in_place`, which the generated `+=` calls
+// instead of `+`
+template<typename Base>
+struct generated_in_place : Base {
+	using Base::Base;
+	friend auto add_in_place(generated_in_place & lhs, generated_in_place const & rhs) -> void {
+		lhs.value.append(rhs.value);
+	}
+};
+
+struct manual {
+	explicit manual(string value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto operator+(manual lhs, manual const & rhs) -> manual {
+		lhs += rhs;
+		return lhs;
+	}
+	auto operator+=(manual const & rhs) -> manual & {
+		value.append(rhs.value);
+		return *this;
+	}
+
+	string value;
+};
+
+} // namespace text
+
+namespace matrix {
+
+constexpr auto size = std::size_t(4);
+using row = std::array<double, size>;
+using rows = std::array<row, size>;
+
+constexpr auto add(rows & lhs, rows const & rhs) -> void {
+	for (std::size_t r = 0; r != size; ++r) {
+		for (std::size_t c = 0; c != size; ++c) {
+			lhs[r][c] += rhs[r][c];
+		}
+	}
+}
+
+struct generated : operators::sequence_range_bracket<generated>, private operators::compound_assignment {
+	constexpr explicit generated(rows value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto begin(generated const & self) {
+		return self.value.begin();
+	}
+	friend constexpr auto begin(generated & self) {
+		return self.value.begin();
+	}
+	friend constexpr auto end(generated const & self) {
+		return self.value.end();
+	}
+	friend constexpr auto end(generated & self) {
+		return self.value.end();
+	}
+	friend constexpr auto operator+(generated lhs, generated const & rhs) -> generated {
+		add(lhs.value, rhs.value);
+		return lhs;
+	}
+
+private:
+	rows value;
+};
+
+struct manual {
+	constexpr explicit manual(rows value_):
+		value(value_)
+	{
+	}
+	constexpr auto operator[](std::size_t const index) const -> row const & {
+		return value[index];
+	}
+	constexpr auto operator[](std::size_t const index) -> row & {
+		return value[index];
+	}
+	friend constexpr auto operator+(manual lhs, manual const & rhs) -> manual {
+		lhs += rhs;
+		return lhs;
+	}
+	constexpr auto operator+=(manual const & rhs) -> manual & {
+		add(value, rhs.value);
+		return *this;
+	}
+
+private:
+	rows value;
+};
+
+constexpr auto initial() -> rows {
+	auto result = rows();
+	for (std::size_t r = 0; r != size; ++r) {
+		for (std::size_t c = 0; c != size; ++c) {
+			result[r][c] = static_cast<double>(r * size + c);
+		}
+	}
+	return result;
+}
+
+} // namespace matrix
+
+// Iterators over an array of `int`. Copying through `contiguous` can use the
+// same `memmove` as copying through pointers, but copying through
+// `random_access` copies one element at a time.
+namespace iterator {
+
+template<typename Derived>
+struct pointer_base : operators::iterator_facade<Derived> {
+	pointer_base() = default;
+	constexpr explicit pointer_base(int * pointer_):
+		pointer(pointer_)
+	{
+	}
+
+	constexpr auto operator*() const -> int & {
+		return *pointer;
+	}
+	friend constexpr auto operator+(Derived const it, std::ptrdiff_t const offset) -> Derived {
+		return Derived(it.pointer + offset);
+	}
+	friend constexpr auto operator-(Derived const lhs, Derived const rhs) -> std::ptrdiff_t {
+		return lhs.pointer - rhs.pointer;
+	}
+
+protected:
+	int * pointer = nullptr;
+};
+
+struct random_access : pointer_base<random_access> {
+	using pointer_base::pointer_base;
+};
+
+struct contiguous : pointer_base<contiguous> {
+	using pointer_base::pointer_base;
+
+	constexpr auto to_address() const -> int * {
+		return pointer;
+	}
+};
+
+constexpr auto size = std::size_t(4096);
+
+} // namespace iterator
+
+// The non-negative elements at the end of a vector. `begin` searches past the
+// negative elements, so it is not free, as for a filtering view.
+namespace skipping {
+
+using values = std::vector<int>;
+
+constexpr auto skipped = std::size_t(64);
+constexpr auto size = std::size_t(1024);
+
+auto initial() -> values {
+	auto result = values(skipped, -1);
+	result.resize(skipped + size, 1);
+	return result;
+}
+
+auto first_non_negative(values const & value) -> values::const_iterator {
+	return std::ranges::find_if(value, [](int const element) { return element >= 0; });
+}
+
+struct generated : operators::sequence_range_bracket<generated> {
+	explicit generated(values value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto begin(generated const & self) -> values::const_iterator {
+		return first_non_negative(self.value);
+	}
+
+private:
+	values value;
+};
+
+struct generated_cached_begin : operators::sequence_range_bracket<generated_cached_begin> {
+	explicit generated_cached_begin(values value_):
+		value(std::move(value_))
+	{
+	}
+	friend auto begin(generated_cached_begin const & self) -> values::const_iterator {
+		return first_non_negative(self.value);
+	}
+	friend auto cached_begin(generated_cached_begin & self) -> values::const_iterator {
+		return self.cache.get(self);
+	}
+
+private:
+	values value;
+	operators::begin_cache<values::const_iterator> cache;
+};
+
+struct manual {
+	explicit manual(values value_):
+		value(std::move(value_)),
+		first(static_cast<std::size_t>(first_non_negative(value) - value.begin()))
+	{
+	}
+	auto operator[](std::size_t const index) const -> int const & {
+		return value[first + index];
+	}
+
+private:
+	values value;
+	std::size_t first;
+};
+
+} // namespace skipping
+
+// A vector-backed range indexed under each `operators::bounds_check`. Summing
+// with a loop bounded by the size lets the optimizer prove the check, but
+// following a list of indices needs the check on every access.
+namespace bounds {
+
+constexpr auto element_count = std::size_t(4096);
+
+auto indices() -> std::vector<std::size_t> {
+	auto result = std::vector<std::size_t>(element_count);
+	for (std::size_t index = 0; index != element_count; ++index) {
+		result[index] = (index * 2654435761U) % element_count;
+	}
+	return result;
+}
+
+template<operators::bounds_check policy>
+struct generated : operators::sequence_range_bracket<generated<policy>, policy> {
+	generated():
+		value(element_count, 1)
+	{
+	}
+	friend auto data(generated const & self) noexcept -> int const * {
+		return self.value.data();
+	}
+	friend auto size(generated const & self) noexcept -> std::size_t {
+		return self.value.size();
+	}
+
+private:
+	std::vector<int> value;
+};
+
+struct manual {
+	manual():
+		value(element_count, 1)
+	{
+	}
+	auto operator[](std::size_t const index) const -> int const & {
+		return value[index];
+	}
+	auto size() const -> std::size_t {
+		return value.size();
+	}
+
+private:
+	std::vector<int> value;
+};
+
+} // namespace bounds
+
+// Looks up a batch of rows in a table too large for the cache, as a feature
+// lookup does.
+namespace lookup {
+
+constexpr auto table_size = std::size_t(1) << 22;
+constexpr auto batch_size = std::size_t(4096);
+
+auto indices() -> std::vector<std::uint32_t> {
+	auto result = std::vector<std::uint32_t>(batch_size);
+	auto state = std::uint32_t(1);
+	for (auto & index : result) {
+		state = state * 1664525U + 1013904223U;
+		index = static_cast<std::uint32_t>(state % table_size);
+	}
+	return result;
+}
+
+struct table {
+	table():
+		value(table_size, 1)
+	{
+	}
+	friend auto data(table const & self) noexcept -> int const * {
+		return self.value.data();
+	}
+
+	OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS
+
+private:
+	std::vector<int> value;
+};
+
+} // namespace lookup
+
+// A square grid of `int` under each `operators::layout`. Transposing reads one
+// grid along rows and writes the other along columns, so the layouts that
+// keep only rows or only columns contiguous miss the cache on one side.
+namespace grid {
+
+constexpr auto side = std::size_t(2048);
+constexpr auto element_count = side * side;
+
+template<typename Layout>
+struct generated : operators::multidimensional_bracket<generated<Layout>, Layout> {
+	generated():
+		value(Layout::required_size(extents(*this)), 1)
+	{
+	}
+	friend auto data(generated const & self) noexcept -> int const * {
+		return self.value.data();
+	}
+	friend auto data(generated & self) noexcept -> int * {
+		return self.value.data();
+	}
+	friend constexpr auto extents(generated const &) noexcept -> std::array<std::size_t, 2> {
+		return {side, side};
+	}
+
+private:
+	std::vector<int> value;
+};
+
+struct manual {
+	manual():
+		value(element_count, 1)
+	{
+	}
+	auto operator[](std::size_t const row, std::size_t const column) const -> int const & {
+		return value[row * side + column];
+	}
+	auto operator[](std::size_t const row, std::size_t const column) -> int & {
+		return value[row * side + column];
+	}
+
+private:
+	std::vector<int> value;
+};
+
+// Calls `function(row, column)` for each position with both coordinates in
+// `[first, last)`. The positions are visited `tile` x `tile` at a time, in row
+// order within each square and from one square to the next, and the squares
+// are aligned to multiples of `tile`. A `tile` of `side` is plain row order.
+template<std::size_t tile>
+auto for_each_position(std::size_t const first, std::size_t const last, auto const function) -> void {
+	for (std::size_t row_start = 0; row_start < last; row_start += tile) {
+		for (std::size_t column_start = 0; column_start < last; column_start += tile) {
+			auto const row_end = std::min(row_start + tile, last);
+			auto const column_end = std::min(column_start + tile, last);
+			for (auto row = std::max(row_start, first); row < row_end; ++row) {
+				for (auto column = std::max(column_start, first); column < column_end; ++column) {
+					function(row, column);
+				}
+			}
+		}
+	}
+}
+
+} // namespace grid
+
+// A non-owning pointer-like type, used to measure `->` and `->*`.
+namespace handle {
+
+template<typename T>
+struct generated : private operators::arrow_star {
+	constexpr explicit generated(T & value):
+		m_pointer(std::addressof(value))
+	{
+	}
+	constexpr auto operator*() const -> T & {
+		return *m_pointer;
+	}
+
+	OPERATORS_ARROW_DEFINITIONS
+
+private:
+	T * m_pointer;
+};
+
+template<typename T>
+struct manual {
+	constexpr explicit manual(T & value):
+		m_pointer(std::addressof(value))
+	{
+	}
+	constexpr auto operator*() const -> T & {
+		return *m_pointer;
+	}
+	constexpr auto operator->() const -> T * {
+		return m_pointer;
+	}
+	template<typename Member>
+	constexpr auto operator->*(Member T::* const member) const -> Member & {
+		return m_pointer->*member;
+	}
+
+private:
+	T * m_pointer;
+};
+
+} // namespace handle
+
+template<typename T>
+auto run_strong_int(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("strong_int", "+=", implementation, [](std::size_t const iterations) {
+		auto value = T(0);
+		auto const step = T(3);
+		for (std::size_t n = 0; n != iterations; ++n) {
+			value += step;
+			do_not_optimize(value);
+		}
+	});
+	bench.run("strong_int", "++", implementation, [](std::size_t const iterations) {
+		auto value = T(0);
+		for (std::size_t n = 0; n != iterations; ++n) {
+			++value;
+			do_not_optimize(value);
+		}
+	});
+	bench.run("strong_int", "postfix ++", implementation, [](std::size_t const iterations) {
+		auto value = T(0);
+		for (std::size_t n = 0; n != iterations; ++n) {
+			auto original = value++;
+			do_not_optimize(original);
+			do_not_optimize(value);
+		}
+	});
+}
+
+template<typename T>
+auto run_bigint(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("bigint", "+=", implementation, [](std::size_t const iterations) {
+		auto value = T(bigint::limbs(8, 0xFFFF'FFF0U));
+		auto const step = T(bigint::limbs(8, 0x0000'0001U));
+		for (std::size_t n = 0; n != iterations; ++n) {
+			value += step;
+			do_not_optimize(value);
+		}
+	});
+	bench.run("bigint", "++", implementation, [](std::size_t const iterations) {
+		auto value = T(bigint::limbs(8, 0U));
+		for (std::size_t n = 0; n != iterations; ++n) {
+			++value;
+			do_not_optimize(value);
+		}
+	});
+}
+
+// The result of `value++` is discarded, as in most loops
+template<typename T>
+auto run_bigint_postfix(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("bigint", "postfix ++", implementation, [](std::size_t const iterations) {
+		auto value = T(bigint::limbs(8, 0U));
+		for (std::size_t n = 0; n != iterations; ++n) {
+			value++;
+			do_not_optimize(value);
+		}
+	});
+}
+
+// Multiplying by the same power of two, known either at run time or at compile
+// time
+auto run_wide(harness const & bench) -> void {
+	bench.run("wide", "*= 8", "generated", [](std::size_t const iterations) {
+		auto value = wide::generated(wide::limbs{1, 2, 3, 4, 5, 6, 7, 8});
+		for (std::size_t n = 0; n != iterations; ++n) {
+			value *= 8U;
+			do_not_optimize(value);
+		}
+	});
+	bench.run("wide", "*= 8", "generated, operators::constant", [](std::size_t const iterations) {
+		auto value = wide::generated(wide::limbs{1, 2, 3, 4, 5, 6, 7, 8});
+		for (std::size_t n = 0; n != iterations; ++n) {
+			value *= operators::constant<8U>();
+			do_not_optimize(value);
+		}
+	});
+}
+
+template<typename T>
+auto append_text(std::size_t const iterations) -> void {
+	auto value = T(text::string());
+	value.value.reserve(1024);
+	auto const step = T(text::string("sixteen chars..."));
+	for (std::size_t n = 0; n != iterations; ++n) {
+		value += step;
+		if (value.value.size() == 1024) {
+			value.value.clear();
+		}
+		do_not_optimize(value);
+	}
+}
+
+template<typename T>
+auto run_text(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("text", "+=", implementation, append_text<T>);
+	bench.count("text", "+=", implementation, "allocations", [](std::size_t const iterations) {
+		auto const before = counting::counted.allocations;
+		append_text<T>(iterations);
+		return counting::counted.allocations - before;
+	});
+	bench.count("text", "+=", implementation, "moves", [](std::size_t const iterations) {
+		auto const before = counting::counted.moves;
+		append_text<T>(iterations);
+		return counting::counted.moves - before;
+	});
+}
+
+template<typename T>
+auto run_matrix(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("matrix", "+=", implementation, [](std::size_t const iterations) {
+		auto value = T(matrix::initial());
+		auto const step = T(matrix::initial());
+		for (std::size_t n = 0; n != iterations; ++n) {
+			value += step;
+			do_not_optimize(value);
+		}
+	});
+	bench.run("matrix", "[]", implementation, [](std::size_t const iterations) {
+		auto value = T(matrix::initial());
+		for (std::size_t n = 0; n != iterations; ++n) {
+			auto const index = n % matrix::size;
+			auto element = value[index][index];
+			do_not_optimize(element);
+			do_not_optimize(value);
+		}
+	});
+}
+
+template<template<typename> typename Handle>
+auto run_handle(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("text", "->", implementation, [](std::size_t const iterations) {
+		auto value = text::manual(text::string("sixteen chars..."));
+		auto pointer = Handle<text::manual>(value);
+		for (std::size_t n = 0; n != iterations; ++n) {
+			auto size = pointer->value.size();
+			do_not_optimize(size);
+			do_not_optimize(pointer);
+		}
+	});
+	bench.run("strong_int", "->*", implementation, [](std::size_t const iterations) {
+		auto value = strong_int::manual(0);
+		auto pointer = Handle<strong_int::manual>(value);
+		for (std::size_t n = 0; n != iterations; ++n) {
+			auto element = pointer->*&strong_int::manual::value;
+			do_not_optimize(element);
+			do_not_optimize(pointer);
+		}
+	});
+}
+
+// Sums a range with an index loop, as code that needs the index often does
+template<typename T>
+auto run_skipping(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("skipping", "[]", implementation, [](std::size_t const iterations) {
+		auto value = T(skipping::initial());
+		for (std::size_t n = 0; n < iterations; n += skipping::size) {
+			auto sum = 0;
+			for (std::size_t index = 0; index != skipping::size; ++index) {
+				sum += value[index];
+			}
+			do_not_optimize(sum);
+			do_not_optimize(value);
+		}
+	});
+}
+
+template<typename T>
+auto run_bounds(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("bounds", "[] sequential", implementation, [](std::size_t const iterations) {
+		auto const value = T();
+		for (std::size_t n = 0; n < iterations; n += bounds::element_count) {
+			auto sum = 0;
+			for (std::size_t index = 0; index != std::ranges::size(value); ++index) {
+				sum += value[index];
+			}
+			do_not_optimize(sum);
+		}
+	});
+	bench.run("bounds", "[] indirect", implementation, [](std::size_t const iterations) {
+		auto const value = T();
+		auto const indices = bounds::indices();
+		for (std::size_t n = 0; n < iterations; n += bounds::element_count) {
+			auto sum = 0;
+			for (auto const index : indices) {
+				sum += value[index];
+			}
+			do_not_optimize(sum);
+		}
+	});
+}
+
+template<typename T, std::size_t tile>
+auto run_grid(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("grid", "transpose", implementation, [](std::size_t const iterations) {
+		auto const source = T();
+		auto target = T();
+		for (std::size_t n = 0; n < iterations; n += grid::element_count) {
+			grid::for_each_position<tile>(0, grid::side, [&](std::size_t const row, std::size_t const column) {
+				target[column, row] = source[row, column];
+			});
+			do_not_optimize(target);
+		}
+	});
+	bench.run("grid", "5-point stencil", implementation, [](std::size_t const iterations) {
+		auto const source = T();
+		auto target = T();
+		for (std::size_t n = 0; n < iterations; n += grid::element_count) {
+			grid::for_each_position<tile>(1, grid::side - 1, [&](std::size_t const row, std::size_t const column) {
+				target[row, column] =
+					source[row - 1, column] +
+					source[row + 1, column] +
+					source[row, column - 1] +
+					source[row, column + 1] -
+					4 * source[row, column];
+			});
+			do_not_optimize(target);
+		}
+	});
+}
+
+auto run_lookup(harness const & bench) -> void {
+	bench.run("lookup", "gather", "generated, operators::gather", [](std::size_t const iterations) {
+		auto const values = lookup::table();
+		auto const indices = lookup::indices();
+		auto output = std::vector<int>(lookup::batch_size);
+		for (std::size_t n = 0; n < iterations; n += lookup::batch_size) {
+			auto result = values[operators::gather(indices, output)];
+			do_not_optimize(result);
+			do_not_optimize(output);
+		}
+	});
+	bench.run("lookup", "gather", "generated, loop", [](std::size_t const iterations) {
+		auto const values = lookup::table();
+		auto const indices = lookup::indices();
+		auto output = std::vector<int>(lookup::batch_size);
+		for (std::size_t n = 0; n < iterations; n += lookup::batch_size) {
+			for (std::size_t position = 0; position != indices.size(); ++position) {
+				output[position] = values[indices[position]];
+			}
+			do_not_optimize(output);
+		}
+	});
+	bench.run("lookup", "gather", "generated, push_back", [](std::size_t const iterations) {
+		auto const values = lookup::table();
+		auto const indices = lookup::indices();
+		auto output = std::vector<int>();
+		for (std::size_t n = 0; n < iterations; n += lookup::batch_size) {
+			output.clear();
+			for (auto const index : indices) {
+				output.push_back(values[index]);
+			}
+			do_not_optimize(output);
+		}
+	});
+}
+
+template<typename T>
+auto subtract_dense(std::size_t const iterations) -> void {
+	auto lhs = T(dense::values(dense::size, 3.0));
+	auto const rhs = T(dense::values(dense::size, 1.0));
+	for (std::size_t n = 0; n < iterations; n += dense::size) {
+		auto result = std::move(lhs) - rhs;
+		do_not_optimize(result);
+		lhs = std::move(result);
+	}
+}
+
+template<typename T>
+auto run_dense(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("dense", "binary -", implementation, subtract_dense<T>);
+	bench.count("dense", "binary -", implementation, "allocations", [](std::size_t const iterations) {
+		auto const before = counting::counted.allocations;
+		subtract_dense<T>(iterations);
+		return counting::counted.allocations - before;
+	});
+}
+
+template<template<typename> typename Vector, typename T>
+auto run_numeric(harness const & bench, std::string_view const element, std::string_view const implementation) -> void {
+	bench.run(element, "+= vector", implementation, [](std::size_t const iterations) {
+		auto lhs = Vector<T>(std::vector<T>(numeric::size, T(0)));
+		auto const rhs = Vector<T>(std::vector<T>(numeric::size, T(1)));
+		for (std::size_t n = 0; n < iterations; n += numeric::size) {
+			lhs += rhs;
+			do_not_optimize(lhs);
+		}
+	});
+	bench.run(element, "+= scalar", implementation, [](std::size_t const iterations) {
+		auto lhs = Vector<T>(std::vector<T>(numeric::size, T(0)));
+		auto rhs = T(1);
+		for (std::size_t n = 0; n < iterations; n += numeric::size) {
+			do_not_optimize(rhs);
+			lhs += rhs;
+			do_not_optimize(lhs);
+		}
+	});
+}
+
+// `evaluate(a, b, c, d)` computes `a += b * c - d`
+// Returns the bytes of `counted_double` elements read and written, scaled to
+// `iterations` elements, because each pass covers `size` of them
+template<typename T>
+auto evaluate_fused(std::size_t const size, std::size_t const iterations, auto const evaluate) -> std::size_t {
+	auto a = T(typename T::values(size, 1.0));
+	auto const b = T(typename T::values(size, 2.0));
+	auto const c = T(typename T::values(size, 0.5));
+	auto const d = T(typename T::values(size, 1.0));
+	auto const before = counting::counted.bytes;
+	auto elements = std::size_t(0);
+	for (; elements < iterations; elements += size) {
+		evaluate(a, b, c, d);
+		do_not_optimize(a);
+	}
+	return (counting::counted.bytes - before) * iterations / elements;
+}
+
+template<template<typename> typename Vector>
+auto run_fused(harness const & bench, std::string_view const implementation, auto const evaluate) -> void {
+	static constexpr auto operations = std::array<std::string_view, fused::sizes.size()>{
+		"a += b * c - d, 1024",
+		"a += b * c - d, 65536",
+		"a += b * c - d, 4194304",
+	};
+	for (std::size_t position = 0; position != fused::sizes.size(); ++position) {
+		auto const size = fused::sizes[position];
+		bench.run("fused", operations[position], implementation, [=](std::size_t const iterations) {
+			evaluate_fused<Vector<double>>(size, iterations, evaluate);
+		});
+		bench.count("fused", operations[position], implementation, "bytes", [=](std::size_t const iterations) {
+			return evaluate_fused<Vector<fused::counted_double>>(size, iterations, evaluate);
+		});
+	}
+}
+
+// Adds two arrays of `strong_int::generated` that are much larger than the
+// cache with its generated `+=` through `operators::parallel_apply`. The
+// iterations are split into passes over at most `parallel_size` elements.
+constexpr auto parallel_size = std::size_t(1) << 24;
+
+auto run_parallel(harness const & bench, std::string_view const implementation, auto const & apply) -> void {
+	bench.run("parallel", "+=", implementation, [&](std::size_t const iterations) {
+		auto lhs = std::vector<strong_int::generated>(parallel_size, strong_int::generated(0));
+		auto const rhs = std::vector<strong_int::generated>(parallel_size, strong_int::generated(1));
+		for (std::size_t n = 0; n < iterations; n += parallel_size) {
+			apply(std::span(lhs).first(std::min(parallel_size, iterations - n)), rhs);
+			do_not_optimize(lhs);
+		}
+	});
+}
+
+auto run_parallel(harness const & bench) -> void {
+	constexpr auto plus_equal = operators::plus_equal_fn();
+	auto const hardware = operators::threads::hardware().count;
+	auto counts = std::vector<std::size_t>();
+	for (std::size_t count = 1; count < hardware; count *= 2) {
+		counts.push_back(count);
+	}
+	counts.push_back(hardware);
+	for (auto const count : counts) {
+		run_parallel(bench, std::format("operators::threads({})", count), [=](auto const lhs, auto const & rhs) {
+			operators::parallel_apply(plus_equal, lhs, rhs, operators::threads(count));
+		});
+	}
+	run_parallel(bench, "std::execution::par_unseq", [=](auto const lhs, auto const & rhs) {
+		operators::parallel_apply(plus_equal, lhs, rhs, std::execution::par_unseq);
+	});
+	run_parallel(bench, "loop", [=](auto const lhs, auto const & rhs) {
+		for (std::size_t index = 0; index != lhs.size(); ++index) {
+			plus_equal(lhs[index], rhs[index]);
+		}
+	});
+}
+
+// `Iterator` is constructed from an `int *`
+template<typename Iterator>
+auto run_iterator(harness const & bench, std::string_view const implementation) -> void {
+	bench.run("iterator", "ranges::copy", implementation, [](std::size_t const iterations) {
+		auto source = std::vector<int>(iterator::size, 1);
+		auto target = std::vector<int>(iterator::size);
+		for (std::size_t n = 0; n < iterations; n += iterator::size) {
+			std::ranges::copy(
+				Iterator(source.data()),
+				Iterator(source.data() + source.size()),
+				Iterator(target.data())
+			);
+			do_not_optimize(target);
+			do_not_optimize(source);
+		}
+	});
+	// Whether `ranges::copy` itself uses `memmove` for contiguous iterators
+	// other than pointers depends on the standard library, but any code can
+	// get pointers from them
+	if constexpr (std::contiguous_iterator<Iterator>) {
+		bench.run("iterator", "ranges::copy(to_address)", implementation, [](std::size_t const iterations) {
+			auto source = std::vector<int>(iterator::size, 1);
+			auto target = std::vector<int>(iterator::size);
+			for (std::size_t n = 0; n < iterations; n += iterator::size) {
+				auto const first = Iterator(source.data());
+				auto const last = Iterator(source.data() + source.size());
+				std::ranges::copy(
+					std::to_address(first),
+					std::to_address(last),
+					std::to_address(Iterator(target.data()))
+				);
+				do_not_optimize(target);
+				do_not_optimize(source);
+			}
+		});
+	}
+}
+
+auto parse(std::string_view const argument) -> std::size_t {
+	auto result = std::size_t(0);
+	auto const [ptr, ec] = std::from_chars(argument.data(), argument.data() + argument.size(), result);
+	if (ec != std::errc() or ptr != argument.data() + argument.size() or result == 0) {
+		throw std::invalid_argument(std::format("Expected a positive integer, got \"{}\"", argument));
+	}
+	return result;
+}
+
+} // namespace
+
+auto main(int argc, char ** argv) -> int {
+	auto const arguments = std::span(argv, static_cast<std::size_t>(argc)).subspan(1);
+	if (arguments.size() > 2) {
+		std::println(std::cerr, "Usage: operators_benchmark [iterations [repetitions]]");
+		return 1;
+	}
+	auto const bench = [&] {
+		try {
+			return harness(
+				arguments.size() >= 1 ? parse(arguments[0]) : 10'000'000,
+				arguments.size() >= 2 ? parse(arguments[1]) : 11
+			);
+		} catch (std::invalid_argument const & ex) {
+			std::println(std::cerr, "{}", ex.what());
+			std::exit(1);
+		}
+	}();
+
+	run_strong_int<strong_int::generated>(bench, "generated");
+	run_strong_int<strong_int::manual>(bench, "manual");
+	run_bigint<bigint::generated>(bench, "generated");
+	run_bigint<bigint::manual>(bench, "manual");
+	run_bigint_postfix<bigint::generated>(bench, "generated");
+	run_bigint_postfix<bigint::generated_postfix_none>(bench, "generated, postfix_return::none");
+	run_bigint_postfix<bigint::manual>(bench, "manual");
+	run_wide(bench);
+	run_dense<dense::generated>(bench, "generated");
+	run_dense<dense::generated_without_negated>(bench, "generated, without negated");
+	run_dense<dense::manual>(bench, "manual");
+	run_parallel(bench);
+	run_numeric<numeric::generated, int>(bench, "elementwise int", "generated");
+	run_numeric<numeric::manual, int>(bench, "elementwise int", "manual");
+	run_numeric<numeric::generated, float>(bench, "elementwise float", "generated");
+	run_numeric<numeric::manual, float>(bench, "elementwise float", "manual");
+	run_numeric<numeric::generated, double>(bench, "elementwise double", "generated");
+	run_numeric<numeric::manual, double>(bench, "elementwise double", "manual");
+	run_fused<fused::generated>(bench, "generated", [](auto & a, auto const & b, auto const & c, auto const & d) {
+		a += b * c - d;
+	});
+	run_fused<fused::manual>(bench, "manual, temporaries", [](auto & a, auto const & b, auto const & c, auto const & d) {
+		a += b * c - d;
+	});
+	run_fused<fused::manual>(bench, "manual, loop", [](auto & a, auto const & b, auto const & c, auto const & d) {
+		for (std::size_t index = 0; index != a.size(); ++index) {
+			a[index] += b[index] * c[index] - d[index];
+		}
+	});
+	run_text<text::generated>(bench, "generated");
+	run_text<text::generated_in_place<text::generated>>(bench, "generated, add_in_place");
+	run_text<text::generated_allocating>(bench, "generated, allocating +");
+	run_text<text::generated_in_place<text::generated_allocating>>(bench, "generated, allocating +, add_in_place");
+	run_text<text::manual>(bench, "manual");
+	run_matrix<matrix::generated>(bench, "generated");
+	run_matrix<matrix::manual>(bench, "manual");
+	run_handle<handle::generated>(bench, "generated");
+	run_handle<handle::manual>(bench, "manual");
+	run_skipping<skipping::generated>(bench, "generated");
+	run_skipping<skipping::generated_cached_begin>(bench, "generated, cached_begin");
+	run_skipping<skipping::manual>(bench, "manual");
+	run_bounds<bounds::generated<operators::bounds_check::unchecked>>(bench, "generated, unchecked");
+	run_bounds<bounds::generated<operators::bounds_check::checked>>(bench, "generated, checked");
+	run_bounds<bounds::generated<operators::bounds_check::debug_checked>>(bench, "generated, debug_checked");
+	run_bounds<bounds::manual>(bench, "manual");
+	run_lookup(bench);
+	run_grid<grid::generated<operators::layout::row_major>, grid::side>(bench, "generated, row_major");
+	run_grid<grid::generated<operators::layout::column_major>, grid::side>(bench, "generated, column_major");
+	run_grid<grid::generated<operators::layout::tiled<16, 16>>, grid::side>(bench, "generated, tiled<16, 16>");
+	run_grid<grid::manual, grid::side>(bench, "manual");
+	run_grid<grid::generated<operators::layout::row_major>, 16>(bench, "generated, row_major, 16 x 16 order");
+	run_grid<grid::generated<operators::layout::column_major>, 16>(bench, "generated, column_major, 16 x 16 order");
+	run_grid<grid::generated<operators::layout::tiled<16, 16>>, 16>(bench, "generated, tiled<16, 16>, 16 x 16 order");
+	run_grid<grid::manual, 16>(bench, "manual, 16 x 16 order");
+	run_iterator<iterator::contiguous>(bench, "generated");
+	run_iterator<iterator::random_access>(bench, "generated, not contiguous");
+	run_iterator<int *>(bench, "manual");
+}
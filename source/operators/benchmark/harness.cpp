@@ -0,0 +1,92 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module operators.benchmark.harness;
+
+import std_module;
+
+namespace operators::benchmark {
+
+// Forces `value` to be materialized in memory and treated as read and written
+// by something the optimizer cannot see, so the work that produced it cannot be
+// removed and cannot be hoisted out of the surrounding loop.
+export template<typename T>
+inline auto do_not_optimize(T & value) -> void {
+	asm volatile("" : : "g"(std::addressof(value)) : "memory");
+}
+
+// Prints one JSON object per line for each measurement:
+//
+// {"workload":"bigint","operation":"+=","implementation":"generated",...}
+//
+// Timings are nanoseconds per iteration. Each function is run once to warm up
+// and then `repetitions` times, and both the fastest and the median run are
+// reported.
+export struct harness {
+	constexpr harness(std::size_t const iterations, std::size_t const repetitions):
+		m_iterations(iterations),
+		m_repetitions(repetitions)
+	{
+	}
+
+	// `function(iterations)` must perform the operation `iterations` times.
+	auto run(
+		std::string_view const workload,
+		std::string_view const operation,
+		std::string_view const implementation,
+		std::invocable<std::size_t> auto function
+	) const -> void {
+		function(m_iterations);
+		auto samples = std::vector<double>();
+		samples.reserve(m_repetitions);
+		for (std::size_t repetition = 0; repetition != m_repetitions; ++repetition) {
+			auto const start = std::chrono::steady_clock::now();
+			function(m_iterations);
+			auto const elapsed = std::chrono::steady_clock::now() - start;
+			samples.push_back(
+				std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(m_iterations)
+			);
+		}
+		std::ranges::sort(samples);
+		std::println(
+			R"({{"workload":"{}","operation":"{}","implementation":"{}","iterations":{},"repetitions":{},"min_ns":{:.4f},"median_ns":{:.4f}}})",
+			workload,
+			operation,
+			implementation,
+			m_iterations,
+			m_repetitions,
+			samples.front(),
+			samples[samples.size() / 2]
+		);
+	}
+
+	// `function(iterations)` must perform the operation `iterations` times and
+	// return how many times `counter` happened, which is reported per iteration
+	// from a single run.
+	auto count(
+		std::string_view const workload,
+		std::string_view const operation,
+		std::string_view const implementation,
+		std::string_view const counter,
+		std::invocable<std::size_t> auto function
+	) const -> void {
+		auto const total = function(m_iterations);
+		std::println(
+			R"({{"workload":"{}","operation":"{}","implementation":"{}","iterations":{},"{}":{:.4f}}})",
+			workload,
+			operation,
+			implementation,
+			m_iterations,
+			counter,
+			static_cast<double>(total) / static_cast<double>(m_iterations)
+		);
+	}
+
+private:
+	std::size_t m_iterations;
+	std::size_t m_repetitions;
+};
+
+} // namespace operators::benchmark
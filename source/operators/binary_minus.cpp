@@ -5,18 +5,36 @@
 
 module;
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 export module operators.binary_minus;
 
+export import operators.negated;
 import std_module;
 
 // Not proposed for standardization
 
+namespace operators::detail {
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto binary_minus(auto && lhs, auto && rhs) OPERATORS_RETURNS_NOEXCEPT(
+	OPERATORS_FORWARD(lhs) + -OPERATORS_FORWARD(rhs)
+)
+
+template<typename LHS, typename RHS> requires requires(LHS && lhs, RHS const & rhs) {
+	OPERATORS_FORWARD(lhs) + negated<std::remove_reference_t<RHS> const &>{rhs};
+}
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto binary_minus(LHS && lhs, RHS && rhs) OPERATORS_RETURNS_NOEXCEPT(
+	OPERATORS_FORWARD(lhs) + negated<std::remove_reference_t<RHS> const &>{rhs}
+)
+
+} // namespace operators::detail
+
 #define OPERATORS_BINARY_MINUS_DEFINITION \
-	constexpr auto operator-(auto && lhs, auto && rhs) OPERATORS_RETURNS( \
-		OPERATORS_FORWARD(lhs) + -OPERATORS_FORWARD(rhs) \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator-(auto && lhs, auto && rhs) OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(binary_minus, \
+		::operators::detail::binary_minus(OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs)) \
 	)
 
 namespace {
@@ -55,16 +73,17 @@ struct adl : operators::binary::minus {
 };
 
 static_assert(adl(4) - adl(1) == 3);
+static_assert(!noexcept(adl(4) - adl(1)));
 
 namespace n {
 
 using operators::binary::operator-;
 
 struct implicit {
-	friend constexpr auto operator-(implicit const x) {
+	friend constexpr auto operator-(implicit const x) noexcept {
 		return implicit{-x.value};
 	}
-	friend constexpr auto operator+(implicit const lhs, implicit const rhs) {
+	friend constexpr auto operator+(implicit const lhs, implicit const rhs) noexcept {
 		return lhs.value + rhs.value;
 	}
 
@@ -76,5 +95,40 @@ static_assert(implicit{4} - implicit{1} == 3);
 } // namespace n
 
 static_assert(n::implicit{4} - n::implicit{1} == 3);
+static_assert(noexcept(n::implicit{4} - n::implicit{1}));
+
+// Accepting `negated` means `rhs` is never negated on its own
+struct subtracts_directly : operators::binary::minus {
+	constexpr explicit subtracts_directly(int value_):
+		value(value_)
+	{
+	}
+	friend auto operator-(subtracts_directly) -> subtracts_directly = delete;
+	friend constexpr auto operator+(subtracts_directly const lhs, subtracts_directly const rhs) noexcept {
+		return lhs.value + rhs.value;
+	}
+	friend constexpr auto operator+(subtracts_directly const lhs, operators::negated<subtracts_directly const &> const rhs) noexcept {
+		return lhs.value - rhs.value.value;
+	}
+
+	int value;
+};
+
+static_assert(subtracts_directly(4) - subtracts_directly(1) == 3);
+static_assert(noexcept(std::declval<subtracts_directly>() - std::declval<subtracts_directly>()));
+
+// A type that accepts neither has no `-`
+struct no_negation : operators::binary::minus {
+	friend constexpr auto operator+(no_negation, no_negation) {
+		return 0;
+	}
+};
+
+template<typename T>
+concept subtractable = requires(T const value) { value - value; };
+
+static_assert(subtractable<adl>);
+static_assert(subtractable<subtracts_directly>);
+static_assert(!subtractable<no_negation>);
 
 } // namespace
@@ -9,6 +9,7 @@ module;
 
 export module operators.bracket;
 
+export import operators.bracket_impl;
 import std_module;
 
 // Not proposed for standardization
@@ -18,10 +19,10 @@ namespace operators_impl {
 template<typename Derived>
 struct iterator_bracket {
 private:
-	constexpr auto self() const & -> Derived const & {
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto self() const & noexcept -> Derived const & {
 		return static_cast<Derived const &>(*this);
 	}
-	constexpr auto self() & -> Derived & {
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto self() & noexcept -> Derived & {
 		return static_cast<Derived &>(*this);
 	}
 public:
@@ -30,20 +31,37 @@ public:
 };
 
 
-template<typename Derived>
+template<typename Derived, operators::bounds_check policy>
 struct sequence_range_bracket {
 private:
-	constexpr auto self() const & -> Derived const & {
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto self() const & noexcept -> Derived const & {
 		return static_cast<Derived const &>(*this);
 	}
-	constexpr auto self() & -> Derived & {
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto self() & noexcept -> Derived & {
 		return static_cast<Derived &>(*this);
 	}
 public:
-	OPERATORS_DETAIL_BRACKET_SEQUENCE_RANGE_DEFINITIONS_IMPL(self())
+	OPERATORS_DETAIL_BRACKET_SEQUENCE_RANGE_DEFINITIONS_WITH_POLICY_IMPL(self(), policy)
 	friend auto operator<=>(sequence_range_bracket, sequence_range_bracket) = default;
 };
 
+
+// `Layout` is an `operators::layout`, and `Derived` is a sequence range with
+// `extents(range)`.
+template<typename Derived, typename Layout>
+struct multidimensional_bracket {
+private:
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto self() const & noexcept -> Derived const & {
+		return static_cast<Derived const &>(*this);
+	}
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto self() & noexcept -> Derived & {
+		return static_cast<Derived &>(*this);
+	}
+public:
+	OPERATORS_DETAIL_BRACKET_MULTIDIMENSIONAL_DEFINITIONS_IMPL(self(), Layout)
+	friend auto operator<=>(multidimensional_bracket, multidimensional_bracket) = default;
+};
+
 } // namespace operators_impl
 
 namespace operators {
@@ -51,8 +69,46 @@ namespace operators {
 export template<typename Derived>
 using iterator_bracket = operators_impl::iterator_bracket<Derived>;
 
-export template<typename Derived>
-using sequence_range_bracket = operators_impl::sequence_range_bracket<Derived>;
+export template<typename Derived, bounds_check policy = bounds_check::unchecked>
+using sequence_range_bracket = operators_impl::sequence_range_bracket<Derived, policy>;
+
+export template<typename Derived, typename Layout = layout::row_major>
+using multidimensional_bracket = operators_impl::multidimensional_bracket<Derived, Layout>;
+
+// Remembers `begin(range)` for a range whose `begin` is expensive, such as a
+// view that searches for its first element. A range opts in to using it for
+// the generated `operator[]` by storing one and defining
+//
+//     friend auto cached_begin(range & r) { return r.m_cache.get(r); }
+//
+// Filling the cache modifies the range, so like the standard views that cache
+// `begin`, this is only for non-const ranges and a const range still calls
+// `begin`. Copying or moving a `begin_cache` gives an empty cache, because
+// the iterator refers to the range it was copied from. Anything else that
+// invalidates the iterator must call `reset`.
+export template<typename Iterator>
+struct begin_cache {
+	constexpr begin_cache() = default;
+	constexpr begin_cache(begin_cache const &) noexcept {
+	}
+	constexpr auto operator=(begin_cache const &) & noexcept -> begin_cache & {
+		reset();
+		return *this;
+	}
+
+	constexpr auto get(auto & range) -> Iterator {
+		if (!m_iterator) {
+			m_iterator.emplace(begin(range));
+		}
+		return *m_iterator;
+	}
+	constexpr auto reset() noexcept -> void {
+		m_iterator.reset();
+	}
+
+private:
+	std::optional<Iterator> m_iterator;
+};
 
 } // namespace operators
 
@@ -92,6 +148,7 @@ static_assert(as_const_ref(macro_iterator(5))[3] == 8);
 static_assert(as_ref(macro_iterator(5))[3] == 8);
 static_assert(as_ref_ref(macro_iterator(5))[3] == 8);
 static_assert(macro_iterator(5)[3] == 8);
+static_assert(!noexcept(std::declval<macro_iterator>()[3]));
 
 
 struct crtp_iterator : operators::iterator_bracket<crtp_iterator> {
@@ -100,10 +157,10 @@ struct crtp_iterator : operators::iterator_bracket<crtp_iterator> {
 	{
 	}
 
-	constexpr auto operator*() {
+	constexpr auto operator*() noexcept {
 		return value;
 	}
-	friend constexpr auto operator+(crtp_iterator const lhs, int const rhs) {
+	friend constexpr auto operator+(crtp_iterator const lhs, int const rhs) noexcept {
 		return crtp_iterator(lhs.value + rhs);
 	}
 
@@ -115,6 +172,7 @@ static_assert(as_const_ref(crtp_iterator(5))[3] == 8);
 static_assert(as_ref(crtp_iterator(5))[3] == 8);
 static_assert(as_ref_ref(crtp_iterator(5))[3] == 8);
 static_assert(crtp_iterator(5)[3] == 8);
+static_assert(noexcept(std::declval<crtp_iterator>()[3]));
 
 
 
@@ -172,5 +230,270 @@ static_assert(as_ref_ref(crtp_sequence_range(5))[3] == 28);
 static_assert(crtp_sequence_range(5)[3] == 28);
 
 
+// `data` is preferred to `begin`
+struct contiguous_range : operators::sequence_range_bracket<contiguous_range> {
+	friend constexpr auto data(contiguous_range const & x) noexcept -> int const * {
+		return x.values.data();
+	}
+	// Never defined
+	friend auto begin(contiguous_range const &) -> int const *;
+
+	std::array<int, 3> values = {1, 2, 3};
+};
+
+static_assert(contiguous_range()[1] == 2);
+static_assert(noexcept(std::declval<contiguous_range const &>()[1]));
+
+
+// `data` that does not return a pointer is ignored
+struct index_data_range : operators::sequence_range_bracket<index_data_range> {
+	friend constexpr auto data(index_data_range const &) -> int {
+		return 0;
+	}
+	friend constexpr auto begin(index_data_range const &) {
+		return macro_iterator(5);
+	}
+};
+
+static_assert(index_data_range()[3] == 8);
+
+
+// `cached_begin` is preferred to `begin`
+struct cached_range : operators::sequence_range_bracket<cached_range> {
+	constexpr explicit cached_range(int & begin_calls_):
+		begin_calls(begin_calls_)
+	{
+	}
+
+	friend constexpr auto begin(cached_range const & x) {
+		++x.begin_calls;
+		return macro_iterator(5);
+	}
+	friend constexpr auto cached_begin(cached_range & x) {
+		return x.cache.get(x);
+	}
+
+	int & begin_calls;
+	operators::begin_cache<macro_iterator> cache;
+};
+
+constexpr auto begin_calls_for_cached_range() -> int {
+	auto begin_calls = 0;
+	auto range = cached_range(begin_calls);
+	auto sum = 0;
+	for (int index = 0; index != 3; ++index) {
+		sum += range[index];
+	}
+	auto copy = range;
+	sum += copy[0];
+	sum += std::as_const(range)[0];
+	return sum == 28 ? begin_calls : -1;
+}
+static_assert(begin_calls_for_cached_range() == 3);
+
+
+template<operators::bounds_check policy>
+struct checked_range : operators::sequence_range_bracket<checked_range<policy>, policy> {
+	friend constexpr auto data(checked_range const & x) noexcept -> int const * {
+		return x.values.data();
+	}
+	friend constexpr auto size(checked_range const & x) noexcept -> std::size_t {
+		return x.values.size();
+	}
+
+	std::array<int, 3> values = {1, 2, 3};
+};
+
+struct macro_checked_range {
+	friend constexpr auto data(macro_checked_range const & x) noexcept -> int const * {
+		return x.values.data();
+	}
+	friend constexpr auto size(macro_checked_range const & x) noexcept -> std::size_t {
+		return x.values.size();
+	}
+
+	OPERATORS_BRACKET_SEQUENCE_RANGE_DEFINITIONS_WITH_POLICY(operators::bounds_check::checked)
+
+	std::array<int, 3> values = {1, 2, 3};
+};
+
+template<typename Range, auto index>
+concept constant_index = requires { typename std::integral_constant<int, Range{}[index]>; };
+
+static_assert(checked_range<operators::bounds_check::unchecked>()[2] == 3);
+static_assert(checked_range<operators::bounds_check::checked>()[2] == 3);
+static_assert(checked_range<operators::bounds_check::debug_checked>()[2] == 3);
+static_assert(macro_checked_range()[2] == 3);
+
+// Failing the check is not a constant expression
+static_assert(constant_index<checked_range<operators::bounds_check::checked>, 2>);
+static_assert(!constant_index<checked_range<operators::bounds_check::checked>, 3>);
+static_assert(!constant_index<checked_range<operators::bounds_check::checked>, -1>);
+static_assert(!constant_index<macro_checked_range, 3>);
+
+// Checking traps rather than throws
+static_assert(noexcept(std::declval<checked_range<operators::bounds_check::checked> const &>()[1]));
+static_assert(noexcept(std::declval<macro_checked_range const &>()[1]));
+
+// Checking needs a size and an integral index
+template<typename Range>
+concept indexable = requires(Range const & range) { range[1]; };
+
+struct unsized_checked_range : operators::sequence_range_bracket<unsized_checked_range, operators::bounds_check::checked> {
+	friend constexpr auto begin(unsized_checked_range const &) {
+		return macro_iterator(5);
+	}
+};
+static_assert(!indexable<unsized_checked_range>);
+
+
+template<typename Layout, std::size_t... sizes>
+struct grid : operators::multidimensional_bracket<grid<Layout, sizes...>, Layout> {
+	constexpr grid() {
+		for (std::size_t index = 0; index != values.size(); ++index) {
+			values[index] = static_cast<int>(index);
+		}
+	}
+	friend constexpr auto data(grid const & x) noexcept -> int const * {
+		return x.values.data();
+	}
+	friend constexpr auto data(grid & x) noexcept -> int * {
+		return x.values.data();
+	}
+	friend constexpr auto extents(grid const &) noexcept -> std::array<std::size_t, sizeof...(sizes)> {
+		return {sizes...};
+	}
+
+	std::array<int, Layout::required_size(std::array{sizes...})> values{};
+};
+
+static_assert(grid<operators::layout::row_major, 3, 4>()[1, 2] == 6);
+static_assert(grid<operators::layout::column_major, 3, 4>()[1, 2] == 7);
+static_assert(grid<operators::layout::row_major, 2, 3, 4>()[1, 2, 3] == 23);
+static_assert(grid<operators::layout::column_major, 2, 3, 4>()[1, 2, 3] == 23);
+static_assert(grid<operators::layout::row_major, 5>()[3] == 3);
+
+// Blocks of 2 x 2: [1, 2] is in block [0, 1], at [1, 0] within it
+static_assert(operators::layout::tiled<2, 2>::required_size(std::array{3, 3}) == 16);
+static_assert(grid<operators::layout::tiled<2, 2>, 4, 4>()[1, 2] == 6);
+static_assert(grid<operators::layout::tiled<2, 2>, 3, 3>()[2, 2] == 12);
+
+struct strided_grid : operators::multidimensional_bracket<strided_grid, operators::layout::strided> {
+	friend constexpr auto data(strided_grid const & x) noexcept -> int const * {
+		return x.values.data();
+	}
+	friend constexpr auto strides(strided_grid const &) noexcept -> std::array<std::size_t, 2> {
+		return {1, 4};
+	}
+
+	std::array<int, 12> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+};
+
+static_assert(strided_grid()[1, 2] == 9);
+static_assert(noexcept(std::declval<strided_grid const &>()[1, 2]));
+
+constexpr auto write_through_multidimensional_bracket() -> bool {
+	auto value = grid<operators::layout::tiled<2, 2>, 4, 4>();
+	value[3, 1] = -1;
+	return value.values[11] == -1;
+}
+static_assert(write_through_multidimensional_bracket());
+
+struct macro_grid {
+	friend constexpr auto data(macro_grid const & x) noexcept -> int const * {
+		return x.values.data();
+	}
+	friend constexpr auto extents(macro_grid const &) noexcept -> std::array<std::size_t, 2> {
+		return {2, 2};
+	}
+
+	OPERATORS_BRACKET_MULTIDIMENSIONAL_DEFINITIONS(operators::layout::tiled<1, 2>)
+
+	std::array<int, 4> values = {0, 1, 2, 3};
+};
+
+static_assert(macro_grid()[1, 0] == 2);
+
+
+// A contiguous slice is a `std::span`
+static_assert(std::same_as<decltype(std::declval<contiguous_range &>()[operators::slice(0, 2)]), std::span<int const>>);
+static_assert(std::ranges::equal(contiguous_range()[operators::slice(1, 3)], std::array{2, 3}));
+
+constexpr auto contiguous_slice_does_not_copy() -> bool {
+	auto const range = contiguous_range();
+	return range[operators::slice(1, 3)].data() == range.values.data() + 1;
+}
+static_assert(contiguous_slice_does_not_copy());
+
+struct iota_range : operators::sequence_range_bracket<iota_range> {
+	friend constexpr auto begin(iota_range const &) {
+		return std::ranges::iota_view(0, 100).begin();
+	}
+};
+
+// Any other slice is a pair of iterators
+static_assert(std::same_as<
+	decltype(iota_range()[operators::slice(2, 5)]),
+	std::ranges::subrange<std::ranges::iterator_t<std::ranges::iota_view<int, int>>>
+>);
+static_assert(std::ranges::equal(iota_range()[operators::slice(2, 5)], std::array{2, 3, 4}));
+static_assert(iota_range()[operators::slice(2, 5)].size() == 3);
+
+// A slice with a stride is an `operators::strided_view`
+static_assert(std::ranges::random_access_range<operators::strided_view<int const *>>);
+static_assert(std::ranges::sized_range<operators::strided_view<int const *>>);
+static_assert(std::ranges::view<operators::strided_view<int const *>>);
+static_assert(std::same_as<decltype(contiguous_range()[operators::slice(0, 3, 2)]), operators::strided_view<int const *>>);
+static_assert(std::ranges::equal(contiguous_range()[operators::slice(0, 3, 2)], std::array{1, 3}));
+static_assert(std::ranges::equal(iota_range()[operators::slice(1, 8, 3)], std::array{1, 4, 7}));
+static_assert(iota_range()[operators::slice(1, 8, 3)][2] == 7);
+static_assert(iota_range()[operators::slice(1, 9, 3)].size() == 3);
+static_assert(iota_range()[operators::slice(4, 4, 3)].empty());
+
+// A checked slice must be within the range
+template<typename Range, auto first, auto last>
+concept constant_slice = requires { typename std::integral_constant<std::size_t, Range{}[operators::slice(first, last)].size()>; };
+
+static_assert(constant_slice<checked_range<operators::bounds_check::checked>, 1, 3>);
+static_assert(!constant_slice<checked_range<operators::bounds_check::checked>, 2, 4>);
+static_assert(!constant_slice<checked_range<operators::bounds_check::checked>, 2, 1>);
+
+
+constexpr auto gather_from_contiguous_range() -> bool {
+	auto const indices = std::array{2, 0, 2, 1, 0, 1};
+	auto output = std::array<int, 8>();
+	auto const result = contiguous_range()[operators::gather(indices, output)];
+	return
+		result.data() == output.data() and
+		std::ranges::equal(result, std::array{3, 1, 3, 2, 1, 2});
+}
+static_assert(gather_from_contiguous_range());
+
+constexpr auto gather_from_iota_range() -> bool {
+	auto const indices = std::array<std::size_t, 3>{50, 7, 99};
+	auto output = std::array<int, 3>();
+	auto const result = iota_range()[operators::gather(indices, output)];
+	return std::ranges::equal(result, std::array{50, 7, 99});
+}
+static_assert(gather_from_iota_range());
+
+static_assert(noexcept(std::declval<contiguous_range const &>()[operators::gather(std::span<int const>(), std::span<int>())]));
+
+// A checked gather needs every index to be in the range and enough output
+template<std::size_t index, std::size_t output_size>
+constexpr auto checked_gather() -> bool {
+	auto const indices = std::array<std::size_t, 2>{0, index};
+	auto output = std::array<int, output_size>();
+	return checked_range<operators::bounds_check::checked>()[operators::gather(indices, output)].size() == 2;
+}
+
+template<std::size_t index, std::size_t output_size>
+concept constant_gather = requires { typename std::bool_constant<checked_gather<index, output_size>()>; };
+
+static_assert(constant_gather<2, 2>);
+static_assert(!constant_gather<3, 2>);
+static_assert(!constant_gather<2, 1>);
+
+
 
 } // namespace
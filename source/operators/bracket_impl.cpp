@@ -5,20 +5,444 @@
 
 module;
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
 #include <operators/returns.hpp>
 
 export module operators.bracket_impl;
 
+import operators.constant;
+import std_module;
+
 // Not proposed for standardization
+
+namespace operators {
+
+// Whether the generated `operator[]` for a sequence range checks that the
+// index is in `[0, size(range))` and traps if it is not.
+export enum class bounds_check {
+	unchecked,
+	checked,
+	// `checked` unless `NDEBUG` is defined. For the macros, this is `NDEBUG` in
+	// the translation unit that uses the macro. For
+	// `operators::sequence_range_bracket`, it is `NDEBUG` when the `operators`
+	// library itself is built.
+	debug_checked,
+};
+
+// A layout maps the indices of a multidimensional `operator[]` to an offset
+// into a sequence range. `offset(range, indices...)` may use `extents(range)`,
+// which has the size of each dimension, and `required_size(extents)` is how
+// many elements storage for those extents needs.
+namespace layout {
+
+// The last index is contiguous
+export struct row_major {
+	static constexpr auto offset(auto const & range, std::integral auto const... indices) noexcept -> std::size_t {
+		auto const & sizes = extents(range);
+		auto result = std::size_t(0);
+		auto dimension = std::size_t(0);
+		((result = result * static_cast<std::size_t>(sizes[dimension++]) + static_cast<std::size_t>(indices)), ...);
+		return result;
+	}
+	static constexpr auto required_size(auto const & extents) noexcept -> std::size_t {
+		auto result = std::size_t(1);
+		for (auto const size : extents) {
+			result *= static_cast<std::size_t>(size);
+		}
+		return result;
+	}
+};
+
+// The first index is contiguous
+export struct column_major {
+	static constexpr auto offset(auto const & range, std::integral auto const... indices) noexcept -> std::size_t {
+		auto const & sizes = extents(range);
+		auto result = std::size_t(0);
+		auto stride = std::size_t(1);
+		auto dimension = std::size_t(0);
+		((result += static_cast<std::size_t>(indices) * stride, stride *= static_cast<std::size_t>(sizes[dimension++])), ...);
+		return result;
+	}
+	static constexpr auto required_size(auto const & extents) noexcept -> std::size_t {
+		return row_major::required_size(extents);
+	}
+};
+
+// `strides(range)` has the distance between consecutive elements of each
+// dimension, for instance for a view of every other column of a matrix. The
+// range knows how much storage that needs.
+export struct strided {
+	static constexpr auto offset(auto const & range, std::integral auto const... indices) noexcept -> std::size_t {
+		auto const & distances = strides(range);
+		auto result = std::size_t(0);
+		auto dimension = std::size_t(0);
+		((result += static_cast<std::size_t>(indices) * static_cast<std::size_t>(distances[dimension++])), ...);
+		return result;
+	}
+};
+
+// Stores blocks with the given extents contiguously, with the elements in a
+// block and the blocks themselves in row-major order, so that neighbors in
+// any dimension are likely to share a cache line or page. The extents of the
+// range are rounded up to a whole number of blocks, and a block extent that
+// is a power of two makes the division and remainder shifts and masks.
+export template<std::size_t... tile_extents> requires((tile_extents > 0) and ...)
+struct tiled {
+	static constexpr auto offset(auto const & range, std::integral auto const... indices) noexcept -> std::size_t {
+		static_assert(sizeof...(indices) == sizeof...(tile_extents));
+		auto const & sizes = extents(range);
+		auto outer = std::size_t(0);
+		auto inner = std::size_t(0);
+		auto dimension = std::size_t(0);
+		((
+			outer = outer * tile_count(static_cast<std::size_t>(sizes[dimension++]), tile_extents) + static_cast<std::size_t>(indices) / tile_extents,
+			inner = inner * tile_extents + static_cast<std::size_t>(indices) % tile_extents
+		), ...);
+		return outer * (tile_extents * ...) + inner;
+	}
+	static constexpr auto required_size(auto const & extents) noexcept -> std::size_t {
+		constexpr auto tiles = std::array{tile_extents...};
+		auto result = std::size_t(1);
+		auto dimension = std::size_t(0);
+		for (auto const size : extents) {
+			result *= tile_count(static_cast<std::size_t>(size), tiles[dimension]) * tiles[dimension];
+			++dimension;
+		}
+		return result;
+	}
+
+private:
+	static constexpr auto tile_count(std::size_t const size, std::size_t const tile) noexcept -> std::size_t {
+		return (size + tile - 1) / tile;
+	}
+};
+
+} // namespace layout
+
+// An index for the sequence range `operator[]` that selects the elements at
+// `first`, `first + stride`, and so on before `last`, without copying them.
+export template<typename Stride = constant<1>> requires(std::integral<Stride> or std::same_as<Stride, constant<1>>)
+struct slice {
+	constexpr slice(std::integral auto const first_, std::integral auto const last_, Stride const stride_ = Stride()) noexcept:
+		first(static_cast<std::size_t>(first_)),
+		last(static_cast<std::size_t>(last_)),
+		stride(stride_)
+	{
+	}
+
+	std::size_t first;
+	std::size_t last;
+	Stride stride;
+};
+
+// An index for the sequence range `operator[]` that copies the element at each
+// of `indices` to the same position in `output`, which must be at least as
+// long. `operator[]` returns the part of `output` that it filled.
+export template<typename Index, typename T>
+struct gather {
+	constexpr gather(std::span<Index const> const indices_, std::span<T> const output_) noexcept:
+		indices(indices_),
+		output(output_)
+	{
+	}
+
+	std::span<Index const> indices;
+	std::span<T> output;
+};
+
+export template<typename Indices, typename Output>
+gather(Indices &&, Output &&) -> gather<
+	std::ranges::range_value_t<Indices>,
+	std::remove_reference_t<std::ranges::range_reference_t<Output>>
+>;
+
+// The elements of a slice with a stride other than 1. The iterator stores an
+// index rather than an advanced iterator, so it never moves past the end of
+// the underlying range.
+export template<std::random_access_iterator Iterator>
+struct strided_view : std::ranges::view_interface<strided_view<Iterator>> {
+private:
+	using difference_type = std::iter_difference_t<Iterator>;
+public:
+	struct iterator {
+		using value_type = std::iter_value_t<Iterator>;
+		using difference_type = std::iter_difference_t<Iterator>;
+		using iterator_concept = std::random_access_iterator_tag;
+
+		iterator() = default;
+		constexpr iterator(Iterator base, difference_type const index, difference_type const stride):
+			m_base(std::move(base)),
+			m_index(index),
+			m_stride(stride)
+		{
+		}
+
+		constexpr auto operator*() const -> std::iter_reference_t<Iterator> {
+			return m_base[m_index * m_stride];
+		}
+		constexpr auto operator[](difference_type const offset) const -> std::iter_reference_t<Iterator> {
+			return m_base[(m_index + offset) * m_stride];
+		}
+
+		constexpr auto operator++() & -> iterator & {
+			++m_index;
+			return *this;
+		}
+		constexpr auto operator++(int) & -> iterator {
+			auto original = *this;
+			++m_index;
+			return original;
+		}
+		constexpr auto operator--() & -> iterator & {
+			--m_index;
+			return *this;
+		}
+		constexpr auto operator--(int) & -> iterator {
+			auto original = *this;
+			--m_index;
+			return original;
+		}
+		constexpr auto operator+=(difference_type const offset) & -> iterator & {
+			m_index += offset;
+			return *this;
+		}
+		constexpr auto operator-=(difference_type const offset) & -> iterator & {
+			m_index -= offset;
+			return *this;
+		}
+
+		friend constexpr auto operator+(iterator it, difference_type const offset) -> iterator {
+			it += offset;
+			return it;
+		}
+		friend constexpr auto operator+(difference_type const offset, iterator it) -> iterator {
+			it += offset;
+			return it;
+		}
+		friend constexpr auto operator-(iterator it, difference_type const offset) -> iterator {
+			it -= offset;
+			return it;
+		}
+		friend constexpr auto operator-(iterator const & lhs, iterator const & rhs) -> difference_type {
+			return lhs.m_index - rhs.m_index;
+		}
+		friend constexpr auto operator==(iterator const & lhs, iterator const & rhs) -> bool {
+			return lhs.m_index == rhs.m_index;
+		}
+		friend constexpr auto operator<=>(iterator const & lhs, iterator const & rhs) -> std::strong_ordering {
+			return lhs.m_index <=> rhs.m_index;
+		}
+
+	private:
+		Iterator m_base;
+		difference_type m_index = 0;
+		difference_type m_stride = 1;
+	};
+
+	strided_view() = default;
+	constexpr strided_view(Iterator first, difference_type const size, difference_type const stride):
+		m_first(std::move(first)),
+		m_size(size),
+		m_stride(stride)
+	{
+	}
+
+	constexpr auto begin() const -> iterator {
+		return iterator(m_first, 0, m_stride);
+	}
+	constexpr auto end() const -> iterator {
+		return iterator(m_first, m_size, m_stride);
+	}
+	constexpr auto size() const -> std::size_t {
+		return static_cast<std::size_t>(m_size);
+	}
+
+private:
+	Iterator m_first;
+	difference_type m_size = 0;
+	difference_type m_stride = 1;
+};
+
+} // namespace operators
+
 namespace operators::detail {
 
-export constexpr auto iterator_operator_bracket(auto && lhs, auto && rhs) OPERATORS_RETURNS(
+export OPERATORS_DETAIL_FORCE_INLINE constexpr auto iterator_operator_bracket(auto && lhs, auto && rhs) OPERATORS_RETURNS_NOEXCEPT(
 	*(OPERATORS_FORWARD(lhs) + OPERATORS_FORWARD(rhs))
 )
 
-export constexpr auto sequence_range_operator_bracket(auto && lhs, auto && rhs) OPERATORS_RETURNS(
+// In order of preference, `lhs[rhs]` for a sequence range is
+//
+// * `data(lhs)[rhs]` if `data(lhs)` is a pointer, because indexing a pointer is
+//   free but `begin` may not be
+// * `*(cached_begin(lhs) + rhs)`, for ranges that opt in to remembering their
+//   `begin`, for instance with `operators::begin_cache`
+// * `*(begin(lhs) + rhs)`
+
+template<typename Range>
+concept has_pointer_data = requires(Range range) {
+	requires std::is_pointer_v<decltype(data(OPERATORS_FORWARD(range)))>;
+};
+
+template<typename Range>
+concept has_cached_begin = requires(Range range) { cached_begin(OPERATORS_FORWARD(range)); };
+
+// The start of a slice, with the same preference as `operator[]`
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto slice_begin(auto && range) OPERATORS_RETURNS_NOEXCEPT(
+	begin(OPERATORS_FORWARD(range))
+)
+
+template<typename Range> requires(has_cached_begin<Range> and !has_pointer_data<Range>)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto slice_begin(Range && range) OPERATORS_RETURNS_NOEXCEPT(
+	cached_begin(OPERATORS_FORWARD(range))
+)
+
+template<has_pointer_data Range>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto slice_begin(Range && range) OPERATORS_RETURNS_NOEXCEPT(
+	data(OPERATORS_FORWARD(range))
+)
+
+// A contiguous slice is a `std::span`, any other slice with a stride of 1 is a
+// `std::ranges::subrange`, and the rest are an `operators::strided_view`.
+template<typename T>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto make_slice(T * const first, slice<constant<1>> const index) noexcept -> std::span<T> {
+	return std::span<T>(first + index.first, index.last - index.first);
+}
+
+template<std::random_access_iterator Iterator>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto make_slice(Iterator const & first, slice<constant<1>> const index) -> std::ranges::subrange<Iterator> {
+	using difference_type = std::iter_difference_t<Iterator>;
+	return std::ranges::subrange<Iterator>(
+		first + static_cast<difference_type>(index.first),
+		first + static_cast<difference_type>(index.last)
+	);
+}
+
+template<std::random_access_iterator Iterator, std::integral Stride>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto make_slice(Iterator const & first, slice<Stride> const index) -> strided_view<Iterator> {
+	using difference_type = std::iter_difference_t<Iterator>;
+	auto const stride = static_cast<std::size_t>(index.stride);
+	return strided_view<Iterator>(
+		first + static_cast<difference_type>(index.first),
+		static_cast<difference_type>((index.last - index.first + stride - 1) / stride),
+		static_cast<difference_type>(stride)
+	);
+}
+
+// Unrolled so that the loop overhead is shared by four loads that do not depend
+// on each other, which also leaves the optimizer free to use vector gather
+// instructions when the target has them.
+template<typename Index, typename T>
+constexpr auto gather_into(auto const first, gather<Index, T> const index)
+	noexcept(std::is_nothrow_assignable_v<T &, decltype(first[index.indices[0]])>)
+	-> std::span<T>
+{
+	auto const count = index.indices.size();
+	auto const indices = index.indices.data();
+	auto const output = index.output.data();
+	auto position = std::size_t(0);
+	for (; count - position >= 4; position += 4) {
+		output[position] = first[indices[position]];
+		output[position + 1] = first[indices[position + 1]];
+		output[position + 2] = first[indices[position + 2]];
+		output[position + 3] = first[indices[position + 3]];
+	}
+	for (; position != count; ++position) {
+		output[position] = first[indices[position]];
+	}
+	return index.output.first(count);
+}
+
+export OPERATORS_DETAIL_FORCE_INLINE constexpr auto sequence_range_operator_bracket(auto && lhs, auto && rhs) OPERATORS_RETURNS_NOEXCEPT(
 	*(begin(OPERATORS_FORWARD(lhs)) + OPERATORS_FORWARD(rhs))
 )
 
+export template<typename Range> requires(has_cached_begin<Range> and !has_pointer_data<Range>)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto sequence_range_operator_bracket(Range && lhs, auto && rhs) OPERATORS_RETURNS_NOEXCEPT(
+	*(cached_begin(OPERATORS_FORWARD(lhs)) + OPERATORS_FORWARD(rhs))
+)
+
+export template<has_pointer_data Range>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto sequence_range_operator_bracket(Range && lhs, auto && rhs) OPERATORS_RETURNS_NOEXCEPT(
+	data(OPERATORS_FORWARD(lhs))[OPERATORS_FORWARD(rhs)]
+)
+
+export template<typename Stride>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto sequence_range_operator_bracket(auto && lhs, slice<Stride> const rhs) OPERATORS_RETURNS_NOEXCEPT(
+	make_slice(slice_begin(OPERATORS_FORWARD(lhs)), rhs)
+)
+
+export template<typename Index, typename T>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto sequence_range_operator_bracket(auto && lhs, gather<Index, T> const rhs) OPERATORS_RETURNS_NOEXCEPT(
+	gather_into(slice_begin(OPERATORS_FORWARD(lhs)), rhs)
+)
+
+export constexpr auto resolve_bounds_check(bounds_check const policy, bool const debug) -> bounds_check {
+	return policy == bounds_check::debug_checked ?
+		(debug ? bounds_check::checked : bounds_check::unchecked) :
+		policy;
+}
+
+// Not constexpr, so an index out of bounds during constant evaluation is a
+// compile error. `__builtin_trap` is a single instruction rather than a call,
+// so the failure path does not get in the way of optimizing the loop around it.
+export [[noreturn]] OPERATORS_DETAIL_FORCE_INLINE inline auto bounds_check_failure() noexcept -> void {
+#if defined(__GNUC__) or defined(__clang__)
+	__builtin_trap();
+#else
+	std::abort();
+#endif
+}
+
+// A single comparison of values the caller already has, with no side effects
+// before it, so an optimizer can prove it in a loop bounded by the size or
+// hoist it out of the loop.
+template<std::integral Index>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto check_index(Index const index, std::integral auto const size) noexcept -> void {
+	if (!(std::cmp_greater_equal(index, 0) and std::cmp_less(index, size))) [[unlikely]] {
+		bounds_check_failure();
+	}
+}
+
+template<typename Stride>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto check_index(slice<Stride> const index, std::integral auto const size) noexcept -> void {
+	if (!(index.first <= index.last and std::cmp_less_equal(index.last, size) and static_cast<std::ptrdiff_t>(index.stride) > 0)) [[unlikely]] {
+		bounds_check_failure();
+	}
+}
+
+template<typename Index, typename T>
+constexpr auto check_index(gather<Index, T> const index, std::integral auto const size) noexcept -> void {
+	if (index.output.size() < index.indices.size()) [[unlikely]] {
+		bounds_check_failure();
+	}
+	for (auto const element : index.indices) {
+		check_index(element, size);
+	}
+}
+
+export template<bounds_check policy> requires(policy == bounds_check::unchecked)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto checked_sequence_range_operator_bracket(auto && lhs, auto && rhs) OPERATORS_RETURNS_NOEXCEPT(
+	sequence_range_operator_bracket(OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs))
+)
+
+export template<bounds_check policy> requires(policy == bounds_check::checked)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto checked_sequence_range_operator_bracket(auto && lhs, auto && rhs)
+	noexcept(
+		noexcept(std::ranges::size(lhs)) and
+		noexcept(sequence_range_operator_bracket(OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs))) and
+		OPERATORS_DETAIL_NOTHROW_RETURNABLE(sequence_range_operator_bracket(OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs)))
+	)
+	-> decltype(check_index(rhs, std::ranges::size(lhs)), sequence_range_operator_bracket(OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs)))
+{
+	check_index(rhs, std::ranges::size(lhs));
+	return sequence_range_operator_bracket(OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs));
+}
+
+export template<typename Layout>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto multidimensional_operator_bracket(auto && lhs, std::integral auto const... indices) OPERATORS_RETURNS_NOEXCEPT(
+	sequence_range_operator_bracket(OPERATORS_FORWARD(lhs), Layout::offset(lhs, indices...))
+)
+
 } // namespace operators::detail
@@ -0,0 +1,133 @@
+# Copyright David Stone 2026.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# Measures how much it costs the compiler to make generated operators available
+# to many types. For each way of getting the operators, this generates a module
+# with OPERATORS_COMPILE_TIME_NAMESPACES namespaces, each of which holds
+# OPERATORS_COMPILE_TIME_TYPES types and OPERATORS_COMPILE_TIME_EXPRESSIONS
+# functions that use an operator. The styles are
+#
+# * adl_base: each type privately derives from operators::compound_assignment
+#   and operators::increment_decrement
+# * namespace_using: each namespace has `using operators::operator+=;` and so
+#   on for each operator it uses
+# * import_macro: each namespace has OPERATORS_IMPORT_COMPOUND_ASSIGNMENT(export)
+#   and `using` declarations for `operator++` and `operator--`
+#
+# Build operators_compile_time_report to compile every style with -ftime-trace
+# and print the frontend time and BMI size of each.
+
+set(OPERATORS_COMPILE_TIME_NAMESPACES 4 CACHE STRING "Namespaces per generated compile-time benchmark module")
+set(OPERATORS_COMPILE_TIME_TYPES 100 CACHE STRING "Types per namespace in the compile-time benchmark")
+set(OPERATORS_COMPILE_TIME_EXPRESSIONS 400 CACHE STRING "Operator expressions per namespace in the compile-time benchmark")
+
+set(operators_compile_time_styles adl_base namespace_using import_macro)
+
+function(operators_compile_time_source style output)
+	set(expressions "a += b" "a -= b" "++a" "a++" "--a" "a--")
+	list(LENGTH expressions expression_count)
+	math(EXPR last_namespace "${OPERATORS_COMPILE_TIME_NAMESPACES} - 1")
+	math(EXPR last_type "${OPERATORS_COMPILE_TIME_TYPES} - 1")
+	math(EXPR last_expression "${OPERATORS_COMPILE_TIME_EXPRESSIONS} - 1")
+
+	set(content "// Generated by compile_time.cmake. Do not edit.\n\nmodule;\n\n")
+	if (style STREQUAL "import_macro")
+		string(APPEND content "#include <operators/compound_assignment.hpp>\n\n")
+	endif()
+	string(APPEND content "export module operators_compile_time.${style};\n\nimport operators;\n")
+
+	if (style STREQUAL "adl_base")
+		set(bases " : private operators::compound_assignment, private operators::increment_decrement")
+	else()
+		set(bases "")
+	endif()
+
+	foreach(namespace RANGE ${last_namespace})
+		string(APPEND content "\nnamespace n${namespace} {\n\n")
+		if (style STREQUAL "namespace_using")
+			string(APPEND content
+				"export using operators::operator+=;\n"
+				"export using operators::operator-=;\n"
+				"export using operators::operator++;\n"
+				"export using operators::operator--;\n\n"
+			)
+		elseif (style STREQUAL "import_macro")
+			string(APPEND content
+				"OPERATORS_IMPORT_COMPOUND_ASSIGNMENT(export)\n"
+				"export using operators::operator++;\n"
+				"export using operators::operator--;\n\n"
+			)
+		endif()
+		foreach(type RANGE ${last_type})
+			string(APPEND content
+				"export struct type${type}${bases} {\n"
+				"\tconstexpr explicit type${type}(int const value_):\n"
+				"\t\tvalue(value_)\n"
+				"\t{\n"
+				"\t}\n"
+				"\tfriend constexpr auto operator+(type${type} const lhs, type${type} const rhs) -> type${type} {\n"
+				"\t\treturn type${type}(lhs.value + rhs.value);\n"
+				"\t}\n"
+				"\tfriend constexpr auto operator-(type${type} const lhs, type${type} const rhs) -> type${type} {\n"
+				"\t\treturn type${type}(lhs.value - rhs.value);\n"
+				"\t}\n"
+				"\tfriend constexpr auto operator+(type${type} const lhs, int const rhs) -> type${type} {\n"
+				"\t\treturn type${type}(lhs.value + rhs);\n"
+				"\t}\n"
+				"\tfriend constexpr auto operator-(type${type} const lhs, int const rhs) -> type${type} {\n"
+				"\t\treturn type${type}(lhs.value - rhs);\n"
+				"\t}\n"
+				"\tint value;\n"
+				"};\n\n"
+			)
+		endforeach()
+		foreach(index RANGE ${last_expression})
+			math(EXPR type "${index} % ${OPERATORS_COMPILE_TIME_TYPES}")
+			math(EXPR expression_index "${index} % ${expression_count}")
+			list(GET expressions ${expression_index} expression)
+			string(APPEND content
+				"export auto expression${index}(type${type} & a, type${type} const & b) -> void {\n"
+				"\tstatic_cast<void>(b);\n"
+				"\tstatic_cast<void>(${expression});\n"
+				"}\n"
+			)
+		endforeach()
+		string(APPEND content "\n} // namespace n${namespace}\n")
+	endforeach()
+
+	file(CONFIGURE OUTPUT "${output}" CONTENT "${content}" @ONLY)
+endfunction()
+
+set(operators_compile_time_directory "${CMAKE_CURRENT_BINARY_DIR}/operators_compile_time")
+set(operators_compile_time_targets)
+foreach(style IN LISTS operators_compile_time_styles)
+	set(source "${operators_compile_time_directory}/${style}.cpp")
+	operators_compile_time_source(${style} "${source}")
+	set(target operators_compile_time_${style})
+	# Not built by default: this exists only to be measured
+	add_library(${target} OBJECT EXCLUDE_FROM_ALL)
+	target_sources(${target} PRIVATE
+		FILE_SET CXX_MODULES
+		BASE_DIRS "${operators_compile_time_directory}"
+		FILES "${source}"
+	)
+	target_link_libraries(${target} PRIVATE operators)
+	target_compile_options(${target} PRIVATE -ftime-trace)
+	list(APPEND operators_compile_time_targets ${target})
+endforeach()
+
+# A list cannot be passed through a command line argument as-is
+string(REPLACE ";" "," operators_compile_time_style_argument "${operators_compile_time_styles}")
+add_custom_target(operators_compile_time_report
+	COMMAND ${CMAKE_COMMAND}
+		-DSTYLES=${operators_compile_time_style_argument}
+		"-DDIRECTORY=${CMAKE_CURRENT_BINARY_DIR}/CMakeFiles"
+		-DNAMESPACES=${OPERATORS_COMPILE_TIME_NAMESPACES}
+		-DTYPES=${OPERATORS_COMPILE_TIME_TYPES}
+		-DEXPRESSIONS=${OPERATORS_COMPILE_TIME_EXPRESSIONS}
+		-P "${CMAKE_CURRENT_LIST_DIR}/report.cmake"
+	DEPENDS ${operators_compile_time_targets}
+	VERBATIM
+)
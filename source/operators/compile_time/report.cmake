@@ -0,0 +1,64 @@
+# Copyright David Stone 2026.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+
+# Usage: cmake -DSTYLES=<style>,... -DDIRECTORY=<CMakeFiles directory>
+#     -DNAMESPACES=<n> -DTYPES=<n> -DEXPRESSIONS=<n> -P report.cmake
+#
+# Prints one JSON object per style:
+#
+# {"style":"adl_base","namespaces":4,"types":100,"expressions":400,"frontend_ms":123.4,"total_ms":234.5,"bmi_bytes":123456}
+#
+# Times come from the -ftime-trace file that clang writes next to the object
+# file of each style, which it overwrites on each compilation. The BMI size is
+# the size of the compiled module interface.
+
+cmake_minimum_required(VERSION 3.28 FATAL_ERROR)
+
+foreach(variable STYLES DIRECTORY NAMESPACES TYPES EXPRESSIONS)
+	if (NOT DEFINED ${variable})
+		message(FATAL_ERROR "${variable} must be defined")
+	endif()
+endforeach()
+
+# Sets `result` to the duration in milliseconds of the named summary event in a
+# -ftime-trace file, or to null if the event is not present.
+function(trace_duration trace name result)
+	if (trace MATCHES "\"dur\":([0-9]+),\"name\":\"${name}\"")
+		math(EXPR whole "${CMAKE_MATCH_1} / 1000")
+		math(EXPR fraction "${CMAKE_MATCH_1} % 1000")
+		string(LENGTH "${fraction}" length)
+		while (length LESS 3)
+			string(PREPEND fraction "0")
+			string(LENGTH "${fraction}" length)
+		endwhile()
+		set(${result} "${whole}.${fraction}" PARENT_SCOPE)
+	else()
+		set(${result} "null" PARENT_SCOPE)
+	endif()
+endfunction()
+
+string(REPLACE "," ";" STYLES "${STYLES}")
+foreach(style IN LISTS STYLES)
+	set(target_directory "${DIRECTORY}/operators_compile_time_${style}.dir")
+	# CMake writes its own JSON files, such as CXXDependInfo.json, to the same
+	# directory, so only the exact trace path will do
+	set(trace_file "${target_directory}/operators_compile_time/${style}.cpp.json")
+	file(GLOB_RECURSE bmis "${target_directory}/*.pcm")
+	if (NOT EXISTS "${trace_file}")
+		message(FATAL_ERROR "No -ftime-trace output at ${trace_file}. Is the compiler clang?")
+	endif()
+	file(READ "${trace_file}" trace)
+	trace_duration("${trace}" "Total Frontend" frontend)
+	trace_duration("${trace}" "Total ExecuteCompiler" total)
+	if (frontend STREQUAL "null" AND total STREQUAL "null")
+		message(FATAL_ERROR "${trace_file} has neither a \"Total Frontend\" nor a \"Total ExecuteCompiler\" event")
+	endif()
+	set(bmi_size "null")
+	if (bmis)
+		list(GET bmis 0 bmi)
+		file(SIZE "${bmi}" bmi_size)
+	endif()
+	message(NOTICE "{\"style\":\"${style}\",\"namespaces\":${NAMESPACES},\"types\":${TYPES},\"expressions\":${EXPRESSIONS},\"frontend_ms\":${frontend},\"total_ms\":${total},\"bmi_bytes\":${bmi_size}}")
+endforeach()
@@ -5,92 +5,170 @@
 
 module;
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 export module operators.compound_assignment;
 
+export import operators.constant;
 import std_module;
 
-// Note that this requires the implementation of your binary operator to allow
-// an rvalue reference parameter on the left-hand side to potentially alias an
-// lvalue reference parameter on the right-hand side.
-#define OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(symbol) \
-constexpr auto operator symbol##=(auto & lhs, auto && rhs) OPERATORS_RETURNS( \
-	lhs = std::move(lhs) symbol OPERATORS_FORWARD(rhs) \
-)
+namespace operators::detail {
+
+// A type can customize `lhs @= rhs` by providing a function that can be found by
+// argument-dependent lookup and modifies `lhs` directly. This avoids the move
+// construction and move assignment of the generated definition, which matters
+// for types that manage a heap allocation. When instrumented, the move
+// assignment of the rebuilt value is counted as a move, so types that are
+// missing that customization show up in the counts. The move construction is
+// not counted: `std::move(lhs)` only binds a reference, and whether `@` then
+// constructs a value from it depends on how the user declared `@`.
+//
+// An `operators::constant` right-hand side is passed on as-is if the type
+// accepts it, and otherwise as its value.
+//
+// The concepts check the same expressions as the return types below. Only the
+// const check comes first, so that a const `lhs` is rejected without looking
+// up `in_place` or `@` for it.
+#define OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(symbol, in_place, name) \
+	template<typename LHS, typename RHS> \
+	concept in_place##_or_rebuildable_directly = \
+		!std::is_const_v<std::remove_reference_t<LHS>> and ( \
+			requires(LHS lhs, RHS rhs) { in_place(lhs, OPERATORS_FORWARD(rhs)); } or \
+			requires(LHS lhs, RHS rhs) { lhs = std::move(lhs) symbol OPERATORS_FORWARD(rhs); } \
+		); \
+	template<typename LHS, typename RHS> \
+	concept in_place##_or_rebuildable = \
+		in_place##_or_rebuildable_directly<LHS, RHS> or ( \
+			::operators::detail::constant_specialization<RHS> and \
+			in_place##_or_rebuildable_directly<LHS, typename std::remove_cvref_t<RHS>::value_type> \
+		); \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto in_place##_or_rebuild(auto & lhs, auto && rhs) \
+		noexcept( \
+			noexcept(lhs = std::move(lhs) symbol OPERATORS_FORWARD(rhs)) and \
+			OPERATORS_DETAIL_NOTHROW_RETURNABLE(lhs = std::move(lhs) symbol OPERATORS_FORWARD(rhs)) \
+		) \
+		-> decltype(lhs = std::move(lhs) symbol OPERATORS_FORWARD(rhs)) \
+	{ \
+		OPERATORS_DETAIL_RECORD_CALL(name); \
+		OPERATORS_DETAIL_RECORD_MOVE(name); \
+		return lhs = std::move(lhs) symbol OPERATORS_FORWARD(rhs); \
+	} \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto in_place##_or_rebuild(auto & lhs, auto && rhs) \
+		noexcept(noexcept(in_place(lhs, OPERATORS_FORWARD(rhs)))) -> decltype(lhs) \
+		requires requires { in_place(lhs, OPERATORS_FORWARD(rhs)); } \
+	{ \
+		OPERATORS_DETAIL_RECORD_CALL(name); \
+		in_place(lhs, OPERATORS_FORWARD(rhs)); \
+		return lhs; \
+	} \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto in_place##_or_rebuild(auto & lhs, ::operators::detail::constant_specialization auto && rhs) \
+		noexcept(noexcept(in_place##_or_rebuild(lhs, rhs()))) \
+		-> decltype(in_place##_or_rebuild(lhs, rhs())) \
+		requires(!in_place##_or_rebuildable_directly<decltype(lhs), decltype(rhs)>) \
+	{ \
+		return in_place##_or_rebuild(lhs, rhs()); \
+	}
+
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(+, add_in_place, plus_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(-, subtract_in_place, minus_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(*, multiply_in_place, times_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(/, divide_in_place, divides_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(%, modulo_in_place, modulo_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(<<, left_shift_in_place, left_shift_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(>>, right_shift_in_place, right_shift_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(&, and_in_place, and_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(|, or_in_place, or_equal)
+OPERATORS_DETAIL_IN_PLACE_OR_REBUILD(^, xor_in_place, xor_equal)
+
+} // namespace operators::detail
+
+// Note that unless the type customizes the operation in place, this requires
+// the implementation of your binary operator to allow an rvalue reference
+// parameter on the left-hand side to potentially alias an lvalue reference
+// parameter on the right-hand side.
+#define OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(symbol, in_place) \
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator symbol##=(auto & lhs, auto && rhs) \
+	noexcept(noexcept(::operators::detail::in_place##_or_rebuild(lhs, OPERATORS_FORWARD(rhs)))) \
+	-> decltype(::operators::detail::in_place##_or_rebuild(lhs, OPERATORS_FORWARD(rhs))) \
+	requires ::operators::detail::in_place##_or_rebuildable<decltype(lhs), decltype(rhs)> \
+{ \
+	return ::operators::detail::in_place##_or_rebuild(lhs, OPERATORS_FORWARD(rhs)); \
+}
 
 #define OPERATORS_COMPOUND_ASSIGNMENT_ALL(...) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(+) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(-) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(*) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(/) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(%) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(<<) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(>>) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(&) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(|) \
-	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(^)
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(+, add_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(-, subtract_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(*, multiply_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(/, divide_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(%, modulo_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(<<, left_shift_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(>>, right_shift_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(&, and_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(|, or_in_place) \
+	__VA_ARGS__ OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(^, xor_in_place)
 
 namespace operators_impl {
 
 namespace plus_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(+)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(+, add_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace minus_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(-)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(-, subtract_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace times_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(*)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(*, multiply_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace divides_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(/)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(/, divide_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace modulo_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(%)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(%, modulo_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace left_shift_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(<<)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(<<, left_shift_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace right_shift_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(>>)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(>>, right_shift_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace and_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(&)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(&, and_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace or_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(|)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(|, or_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
 namespace xor_equal {
 struct impl {
-	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(^)
+	friend OPERATORS_COMPOUND_ASSIGNMENT_DEFINITION(^, xor_in_place)
 	friend auto operator<=>(impl, impl) = default;
 };
 }
@@ -101,6 +179,29 @@ struct impl {
 };
 }
 
+// `lhs @= rhs` as a function object, for algorithms that take one. These are
+// outside of `operators` so that the operator they call is found the same way
+// as in the caller's own code: by argument-dependent lookup, which finds the
+// generated operators only for the types that opt in to them.
+#define OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(symbol, name) \
+	struct name { \
+		using is_transparent = void; \
+		OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator()(auto && lhs, auto && rhs) const OPERATORS_RETURNS_NOEXCEPT( \
+			OPERATORS_FORWARD(lhs) symbol##= OPERATORS_FORWARD(rhs) \
+		) \
+	};
+
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(+, plus_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(-, minus_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(*, times_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(/, divides_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(%, modulo_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(<<, left_shift_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(>>, right_shift_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(&, and_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(|, or_equal_fn)
+OPERATORS_DETAIL_COMPOUND_ASSIGNMENT_FUNCTION(^, xor_equal_fn)
+
 } // namespace operators_impl
 
 namespace operators {
@@ -119,4 +220,40 @@ export using or_equal = operators_impl::or_equal::impl;
 export using xor_equal = operators_impl::xor_equal::impl;
 export using compound_assignment = operators_impl::compound_assignment::impl;
 
+export using plus_equal_fn = operators_impl::plus_equal_fn;
+export using minus_equal_fn = operators_impl::minus_equal_fn;
+export using times_equal_fn = operators_impl::times_equal_fn;
+export using divides_equal_fn = operators_impl::divides_equal_fn;
+export using modulo_equal_fn = operators_impl::modulo_equal_fn;
+export using left_shift_equal_fn = operators_impl::left_shift_equal_fn;
+export using right_shift_equal_fn = operators_impl::right_shift_equal_fn;
+export using and_equal_fn = operators_impl::and_equal_fn;
+export using or_equal_fn = operators_impl::or_equal_fn;
+export using xor_equal_fn = operators_impl::xor_equal_fn;
+
+// Whether the binary operation that a function object applies is associative
+// or commutative, which tells `operators::parallel_reduce` how far it may
+// regroup and reorder the values it combines. Specialize these for other
+// function objects. As with `std::plus`, `+` and `*` count as associative even
+// for floating-point types, for which regrouping can change how the result is
+// rounded. The compound assignment function objects above modify their left
+// operand rather than combine two values, so these are `false` for them.
+export template<typename Function>
+inline constexpr auto is_associative = false;
+
+export template<typename Function>
+inline constexpr auto is_commutative = false;
+
+#define OPERATORS_DETAIL_ASSOCIATIVE_AND_COMMUTATIVE(function_object) \
+	template<typename T> \
+	inline constexpr auto is_associative<function_object<T>> = true; \
+	template<typename T> \
+	inline constexpr auto is_commutative<function_object<T>> = true;
+
+OPERATORS_DETAIL_ASSOCIATIVE_AND_COMMUTATIVE(std::plus)
+OPERATORS_DETAIL_ASSOCIATIVE_AND_COMMUTATIVE(std::multiplies)
+OPERATORS_DETAIL_ASSOCIATIVE_AND_COMMUTATIVE(std::bit_and)
+OPERATORS_DETAIL_ASSOCIATIVE_AND_COMMUTATIVE(std::bit_or)
+OPERATORS_DETAIL_ASSOCIATIVE_AND_COMMUTATIVE(std::bit_xor)
+
 } // namespace operators
@@ -11,6 +11,8 @@ export module operators.compound_assignment_test;
 
 import operators.compound_assignment;
 
+import std_module;
+
 namespace {
 
 #define OPERATORS_ARITHMETIC_OPERATORS_FRIENDS(type) \
@@ -213,6 +215,7 @@ private:
 };
 
 static_assert(has_plus_equal<plus_only>);
+static_assert(!has_plus_equal<plus_only const>);
 static_assert(!has_minus_equal<plus_only>);
 static_assert(!has_times_equal<plus_only>);
 static_assert(!has_divides_equal<plus_only>);
@@ -223,6 +226,34 @@ static_assert(!has_and_equal<plus_only>);
 static_assert(!has_or_equal<plus_only>);
 static_assert(!has_xor_equal<plus_only>);
 
+template<typename T>
+concept has_plus_equal_int = requires(T value) { value += 1; };
+
+namespace unconstrained_in_place {
+
+// Checking whether `add_in_place` can be called with a const `lhs` would
+// instantiate the body to deduce the return type, which is a hard error. The
+// generated operator must reject a const `lhs` before getting that far.
+struct s : operators::plus_equal {
+	constexpr explicit s(int value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto add_in_place(auto & lhs, int const rhs) {
+		lhs.value += rhs;
+	}
+	friend auto operator==(s, s) -> bool = default;
+
+private:
+	int value;
+};
+
+static_assert(check_compound_assignment(s(5), 3, s(8), plus_equal));
+static_assert(has_plus_equal_int<s>);
+static_assert(!has_plus_equal_int<s const>);
+
+} // namespace unconstrained_in_place
+
 struct minus_only : operators::minus_equal {
 	constexpr explicit minus_only(int value_):
 		value(value_)
@@ -421,4 +452,229 @@ static_assert(!has_and_equal<xor_only>);
 static_assert(!has_or_equal<xor_only>);
 static_assert(has_xor_equal<xor_only>);
 
+// Cannot be moved, so this can only work if every operator is done in place
+struct in_place : operators::compound_assignment {
+	constexpr explicit in_place(int value_):
+		value(value_)
+	{
+	}
+	in_place(in_place &&) = delete;
+	auto operator=(in_place &&) -> in_place & = delete;
+
+	friend constexpr auto add_in_place(in_place & lhs, int const rhs) noexcept -> void {
+		lhs.value += rhs;
+	}
+	friend constexpr auto subtract_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value -= rhs;
+	}
+	friend constexpr auto multiply_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value *= rhs;
+	}
+	friend constexpr auto divide_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value /= rhs;
+	}
+	friend constexpr auto modulo_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value %= rhs;
+	}
+	friend constexpr auto left_shift_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value <<= rhs;
+	}
+	friend constexpr auto right_shift_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value >>= rhs;
+	}
+	friend constexpr auto and_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value &= rhs;
+	}
+	friend constexpr auto or_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value |= rhs;
+	}
+	friend constexpr auto xor_in_place(in_place & lhs, int const rhs) -> void {
+		lhs.value ^= rhs;
+	}
+
+	int value;
+};
+
+constexpr bool check_in_place(int const lhs, int const rhs, int const expected, auto function) {
+	auto value = in_place(lhs);
+	auto & result = function(value, rhs);
+	return &result == &value and value.value == expected;
+}
+
+static_assert(check_in_place(5, 3, 8, [](auto & lhs, auto rhs) -> auto & { return lhs += rhs; }));
+static_assert(check_in_place(5, 3, 2, [](auto & lhs, auto rhs) -> auto & { return lhs -= rhs; }));
+static_assert(check_in_place(5, 3, 15, [](auto & lhs, auto rhs) -> auto & { return lhs *= rhs; }));
+static_assert(check_in_place(5, 3, 1, [](auto & lhs, auto rhs) -> auto & { return lhs /= rhs; }));
+static_assert(check_in_place(5, 3, 2, [](auto & lhs, auto rhs) -> auto & { return lhs %= rhs; }));
+static_assert(check_in_place(5, 3, 40, [](auto & lhs, auto rhs) -> auto & { return lhs <<= rhs; }));
+static_assert(check_in_place(5, 3, 0, [](auto & lhs, auto rhs) -> auto & { return lhs >>= rhs; }));
+static_assert(check_in_place(5, 3, 1, [](auto & lhs, auto rhs) -> auto & { return lhs &= rhs; }));
+static_assert(check_in_place(5, 3, 7, [](auto & lhs, auto rhs) -> auto & { return lhs |= rhs; }));
+static_assert(check_in_place(5, 3, 6, [](auto & lhs, auto rhs) -> auto & { return lhs ^= rhs; }));
+
+static_assert(noexcept(std::declval<in_place &>() += 1));
+static_assert(!noexcept(std::declval<in_place &>() -= 1));
+
+struct nothrow : operators::plus_equal, operators::minus_equal {
+	constexpr explicit nothrow(int value_) noexcept:
+		value(value_)
+	{
+	}
+
+	friend constexpr auto operator+(nothrow const lhs, nothrow const rhs) noexcept {
+		return nothrow(lhs.value + rhs.value);
+	}
+	friend constexpr auto operator-(nothrow const lhs, nothrow const rhs) {
+		return nothrow(lhs.value - rhs.value);
+	}
+
+	int value;
+};
+
+static_assert(noexcept(std::declval<nothrow &>() += std::declval<nothrow>()));
+static_assert(!noexcept(std::declval<nothrow &>() -= std::declval<nothrow>()));
+static_assert(!noexcept(std::declval<adl &>() += std::declval<adl>()));
+
+// When both are available, the in-place version is preferred
+struct counts_moves : operators::plus_equal, operators::minus_equal {
+	constexpr explicit counts_moves(int value_):
+		value(value_)
+	{
+	}
+	constexpr counts_moves(counts_moves && other):
+		value(other.value),
+		moves(other.moves + 1)
+	{
+	}
+	constexpr auto operator=(counts_moves && other) -> counts_moves & {
+		value = other.value;
+		moves = other.moves + 1;
+		return *this;
+	}
+
+	friend constexpr auto operator+(counts_moves && lhs, int const rhs) -> counts_moves {
+		lhs.value += rhs;
+		return std::move(lhs);
+	}
+	friend constexpr auto operator-(counts_moves && lhs, int const rhs) -> counts_moves {
+		lhs.value -= rhs;
+		return std::move(lhs);
+	}
+	friend constexpr auto add_in_place(counts_moves & lhs, int const rhs) -> void {
+		lhs.value += rhs;
+	}
+
+	int value;
+	int moves = 0;
+};
+
+constexpr auto moves_for(int const rhs, auto function) -> int {
+	auto value = counts_moves(5);
+	function(value, rhs);
+	return value.moves;
+}
+
+static_assert(moves_for(3, [](auto & lhs, auto rhs) { lhs += rhs; }) == 0);
+static_assert(moves_for(3, [](auto & lhs, auto rhs) { lhs -= rhs; }) == 2);
+
+// `operators::constant` reaches a type that overloads for it
+struct shifts : operators::times_equal, operators::divides_equal {
+	constexpr explicit shifts(unsigned value_):
+		value(value_)
+	{
+	}
+
+	friend constexpr auto operator*(shifts lhs, unsigned const rhs) -> shifts {
+		lhs.value *= rhs;
+		return lhs;
+	}
+	template<auto rhs> requires(std::has_single_bit(static_cast<unsigned>(rhs)))
+	friend constexpr auto operator*(shifts lhs, operators::constant<rhs>) -> shifts {
+		lhs.value <<= std::countr_zero(static_cast<unsigned>(rhs));
+		++lhs.shift_count;
+		return lhs;
+	}
+	friend constexpr auto divide_in_place(shifts & lhs, unsigned const rhs) -> void {
+		lhs.value /= rhs;
+	}
+	template<auto rhs> requires(std::has_single_bit(static_cast<unsigned>(rhs)))
+	friend constexpr auto divide_in_place(shifts & lhs, operators::constant<rhs>) -> void {
+		lhs.value >>= std::countr_zero(static_cast<unsigned>(rhs));
+		++lhs.shift_count;
+	}
+
+	unsigned value;
+	int shift_count = 0;
+};
+
+constexpr auto uses_constant_overloads() -> bool {
+	auto value = shifts(5);
+	value *= operators::constant<8U>();
+	value *= operators::constant<3U>();
+	value /= operators::constant<4U>();
+	value /= 5U;
+	return value.value == 6 and value.shift_count == 2;
+}
+static_assert(uses_constant_overloads());
+
+// Converting `operators::constant` to `implicit` would take two user-defined
+// conversions, so the generated operator passes on the value instead
+struct implicit : operators::compound_assignment {
+	constexpr implicit(int value_):
+		value(value_)
+	{
+	}
+
+	OPERATORS_ARITHMETIC_OPERATORS_FRIENDS(implicit)
+private:
+	int value;
+};
+
+static_assert(check_compound_assignment(implicit(5), operators::constant<3>(), implicit(8), plus_equal));
+static_assert(check_compound_assignment(implicit(5), operators::constant<3>(), implicit(15), times_equal));
+static_assert(check_compound_assignment(implicit(5), operators::constant<3>(), implicit(40), left_shift_equal));
+static_assert(!has_plus_equal<implicit const>);
+
+static_assert(check_compound_assignment(adl(5), adl(3), adl(8), operators::plus_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(2), operators::minus_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(15), operators::times_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(1), operators::divides_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(2), operators::modulo_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(40), operators::left_shift_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(0), operators::right_shift_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(1), operators::and_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(7), operators::or_equal_fn()));
+static_assert(check_compound_assignment(adl(5), adl(3), adl(6), operators::xor_equal_fn()));
+static_assert(check_compound_assignment(5, 3, 8, operators::plus_equal_fn()));
+static_assert(check_compound_assignment(macro::implicit(5), macro::implicit(3), macro::implicit(8), operators::plus_equal_fn()));
+
+// The function objects find operators the way the caller's code would, so they
+// do not generate `+=` for a type that did not opt in
+struct not_opted_in {
+	constexpr explicit not_opted_in(int value_):
+		value(value_)
+	{
+	}
+
+	OPERATORS_ARITHMETIC_OPERATORS_FRIENDS(not_opted_in)
+private:
+	int value;
+};
+
+static_assert(std::invocable<operators::plus_equal_fn, adl &, adl>);
+static_assert(!std::invocable<operators::plus_equal_fn, adl const &, adl>);
+static_assert(!std::invocable<operators::plus_equal_fn, not_opted_in &, not_opted_in>);
+static_assert(std::is_empty_v<operators::plus_equal_fn>);
+static_assert(requires { typename operators::plus_equal_fn::is_transparent; });
+static_assert(noexcept(operators::plus_equal_fn()(std::declval<int &>(), 1)));
+static_assert(std::same_as<decltype(operators::plus_equal_fn()(std::declval<int &>(), 1)), int &>);
+
+static_assert(!operators::is_associative<operators::plus_equal_fn>);
+static_assert(!operators::is_commutative<operators::xor_equal_fn>);
+static_assert(!operators::is_associative<operators::minus_equal_fn>);
+static_assert(!operators::is_commutative<operators::left_shift_equal_fn>);
+static_assert(operators::is_associative<std::multiplies<>>);
+static_assert(operators::is_commutative<std::plus<int>>);
+static_assert(!operators::is_commutative<std::minus<>>);
+
 } // namespace
@@ -0,0 +1,62 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module operators.constant;
+
+import std_module;
+
+namespace operators_impl::constant {
+
+template<auto value_>
+struct impl : std::integral_constant<decltype(value_), value_> {
+};
+
+} // namespace operators_impl::constant
+
+namespace operators {
+
+// A value known at compile time, for the right-hand side of a generated
+// operator. `x *= operators::constant<8>()` passes the `constant` itself to
+// `multiply_in_place` or `operator*`, so a type can overload for it and, for
+// instance, shift instead of multiplying. A type that does not overload for it
+// gets `x *= 8`. It is a distinct type rather than `std::integral_constant` so
+// that overloading for `constant` never catches an unrelated argument. Like
+// the operator base classes, it is defined outside of `operators` so that
+// argument-dependent lookup does not find the namespace-scope operators in
+// addition to the ones a type gets from its bases.
+export template<auto value>
+using constant = operators_impl::constant::impl<value>;
+
+// Passed by the generated `++` and `--` to `+=` and `-=`
+export using one = constant<1>;
+
+} // namespace operators
+
+namespace operators::detail {
+
+template<auto value>
+auto deduce_constant(constant<value>) -> void;
+
+export template<typename T>
+concept constant_specialization = requires(std::remove_cvref_t<T> value) {
+	::operators::detail::deduce_constant(value);
+};
+
+} // namespace operators::detail
+
+namespace {
+
+static_assert(operators::constant<8>() == 8);
+static_assert(operators::constant<8>::value == 8);
+static_assert(std::same_as<operators::constant<8>::value_type, int>);
+static_assert(std::same_as<operators::constant<8U>::value_type, unsigned>);
+static_assert(std::convertible_to<operators::one, int>);
+
+static_assert(operators::detail::constant_specialization<operators::one>);
+static_assert(operators::detail::constant_specialization<operators::constant<8> const &>);
+static_assert(!operators::detail::constant_specialization<std::integral_constant<int, 1>>);
+static_assert(!operators::detail::constant_specialization<int>);
+
+} // namespace
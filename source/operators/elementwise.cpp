@@ -0,0 +1,208 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <operators/force_inline.hpp>
+
+export module operators.elementwise;
+
+import operators.compound_assignment;
+import std_module;
+
+// Not proposed for standardization
+
+namespace operators_impl::elementwise {
+
+template<typename Derived>
+using element_t = std::remove_pointer_t<decltype(std::ranges::data(std::declval<Derived &>()))>;
+
+template<typename T, typename Derived>
+concept scalar = std::is_arithmetic_v<T> and std::convertible_to<T, element_t<Derived>>;
+
+template<typename T, typename Derived>
+concept operand = std::same_as<T, Derived> or scalar<T, Derived>;
+
+// The type of each value that an operand contributes: a scalar contributes
+// itself, and a `Derived` contributes its elements.
+template<typename T, typename Derived>
+using value_t = std::conditional_t<std::is_arithmetic_v<T>, T, element_t<Derived>>;
+
+// The loops index raw pointers with a count known before they start, which is
+// the form that compilers vectorize for every target they are built for. `lhs`
+// and `rhs` may be the same object, but element `index` of the result depends
+// only on element `index` of each, so that is fine.
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto for_each_element(auto & lhs, auto const & rhs, auto const function) -> void {
+	auto const target = std::ranges::data(lhs);
+	auto const size = static_cast<std::size_t>(std::ranges::size(lhs));
+	if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(rhs)>>) {
+		for (std::size_t index = 0; index != size; ++index) {
+			function(target[index], rhs);
+		}
+	} else {
+		auto const source = std::ranges::data(rhs);
+		for (std::size_t index = 0; index != size; ++index) {
+			function(target[index], source[index]);
+		}
+	}
+}
+
+// `in_place(lhs, rhs)` applies `lhs[index] @= rhs[index]`, or `lhs[index] @=
+// rhs` for a scalar, to each element. `lhs @ rhs` does that to a copy of `lhs`,
+// and `scalar @ rhs` overwrites each element of a copy of `rhs` with
+// `scalar @ rhs[index]`.
+#define OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(symbol, in_place) \
+	template<operand<Derived> RHS> \
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto in_place(Derived & lhs, RHS const & rhs) -> void \
+		requires requires(element_t<Derived> & element, value_t<RHS, Derived> const value) { element symbol##= value; } \
+	{ \
+		::operators_impl::elementwise::for_each_element(lhs, rhs, [](auto & element, auto const value) { \
+			element symbol##= value; \
+		}); \
+	} \
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto operator symbol(Derived lhs, operand<Derived> auto const & rhs) -> Derived \
+		requires requires { in_place(lhs, rhs); } \
+	{ \
+		in_place(lhs, rhs); \
+		return lhs; \
+	} \
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto operator symbol(scalar<Derived> auto const lhs, Derived rhs) -> Derived \
+		requires requires(element_t<Derived> const element) { static_cast<element_t<Derived>>(lhs symbol element); } \
+	{ \
+		::operators_impl::elementwise::for_each_element(rhs, lhs, [](auto & element, auto const value) { \
+			element = static_cast<element_t<Derived>>(value symbol element); \
+		}); \
+		return rhs; \
+	}
+
+template<typename Derived>
+struct base : operators::compound_assignment {
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(+, add_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(-, subtract_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(*, multiply_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(/, divide_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(%, modulo_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(<<, left_shift_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(>>, right_shift_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(&, and_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(|, or_in_place)
+	OPERATORS_DETAIL_ELEMENTWISE_DEFINITIONS(^, xor_in_place)
+
+	friend auto operator<=>(base, base) = default;
+};
+
+} // namespace operators_impl::elementwise
+
+namespace operators {
+
+// `Derived` is a contiguous sequence of numbers with `std::ranges::data` and
+// `std::ranges::size`, and it is copyable. This generates each compound
+// assignment operator and binary operator that the element type supports,
+// applied element by element with another `Derived` of the same size or with a
+// scalar.
+export template<typename Derived>
+using elementwise = operators_impl::elementwise::base<Derived>;
+
+} // namespace operators
+
+namespace {
+
+template<typename T>
+struct values : operators::elementwise<values<T>> {
+	constexpr explicit values(std::array<T, 4> const elements_):
+		elements(elements_)
+	{
+	}
+
+	constexpr auto data() -> T * {
+		return elements.data();
+	}
+	constexpr auto data() const -> T const * {
+		return elements.data();
+	}
+	constexpr auto size() const -> std::size_t {
+		return elements.size();
+	}
+
+	std::array<T, 4> elements;
+};
+
+template<typename LHS, typename RHS>
+concept modulo_assignable = requires(LHS lhs, RHS const & rhs) { lhs %= rhs; };
+
+template<typename LHS, typename RHS>
+concept modulo_able = requires(LHS const & lhs, RHS const & rhs) { lhs % rhs; };
+
+template<typename LHS, typename RHS>
+concept shiftable = requires(LHS const & lhs, RHS const & rhs) { lhs << rhs; };
+
+template<typename LHS, typename RHS>
+concept andable = requires(LHS const & lhs, RHS const & rhs) { lhs & rhs; };
+
+static_assert(modulo_assignable<values<int>, values<int>>);
+static_assert(modulo_assignable<values<int>, int>);
+static_assert(!modulo_assignable<values<float>, values<float>>);
+static_assert(!modulo_assignable<values<int>, values<long>>);
+static_assert(!modulo_assignable<values<int>, int *>);
+static_assert(!modulo_assignable<values<int>, double>);
+static_assert(modulo_able<values<int>, long>);
+static_assert(modulo_able<long, values<int>>);
+static_assert(!modulo_able<values<int>, double>);
+static_assert(!modulo_able<double, values<int>>);
+static_assert(shiftable<values<unsigned>, unsigned>);
+static_assert(!shiftable<values<double>, int>);
+static_assert(!shiftable<values<int>, double>);
+static_assert(!shiftable<double, values<int>>);
+static_assert(andable<values<int>, int>);
+static_assert(!andable<values<int>, float>);
+static_assert(!andable<float, values<int>>);
+
+constexpr auto compound_with_values() -> bool {
+	auto a = values<int>({12, 13, 14, 15});
+	auto const b = values<int>({1, 2, 3, 4});
+	a += b;
+	a -= b;
+	a *= b;
+	a /= b;
+	a %= values<int>({5, 5, 5, 5});
+	a <<= b;
+	a >>= values<int>({1, 1, 1, 1});
+	a &= values<int>({-1, -1, 0, -1});
+	a |= b;
+	a ^= values<int>({1, 1, 1, 1});
+	return a.elements == std::array{2, 7, 2, 5};
+}
+static_assert(compound_with_values());
+
+constexpr auto compound_with_scalar() -> bool {
+	auto a = values<double>({1.0, 2.0, 3.0, 4.0});
+	a *= 2;
+	a -= 1.0;
+	a /= 0.5F;
+	return a.elements == std::array{2.0, 6.0, 10.0, 14.0};
+}
+static_assert(compound_with_scalar());
+
+constexpr auto binary() -> bool {
+	auto const a = values<int>({1, 2, 3, 4});
+	auto const b = values<int>({4, 3, 2, 1});
+	return
+		(a + b).elements == std::array{5, 5, 5, 5} and
+		(a - 1).elements == std::array{0, 1, 2, 3} and
+		(10 - a).elements == std::array{9, 8, 7, 6} and
+		(12 / a).elements == std::array{12, 6, 4, 3} and
+		(1 << a).elements == std::array{2, 4, 8, 16} and
+		(a ^ a).elements == std::array{0, 0, 0, 0};
+}
+static_assert(binary());
+
+constexpr auto aliases() -> bool {
+	auto a = values<float>({1.0F, 2.0F, 3.0F, 4.0F});
+	a *= a;
+	return a.elements == std::array{1.0F, 4.0F, 9.0F, 16.0F};
+}
+static_assert(aliases());
+
+} // namespace
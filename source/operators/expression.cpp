@@ -0,0 +1,257 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <operators/force_inline.hpp>
+#include <operators/forward.hpp>
+
+export module operators.expression;
+
+import operators.compound_assignment;
+import std_module;
+
+// Not proposed for standardization
+
+namespace operators_impl::expression {
+
+template<typename Derived>
+struct base;
+
+template<typename Derived, typename Operation, typename LHS, typename RHS>
+struct node;
+
+template<typename Derived>
+auto deduce_derived(base<Derived> const &) -> Derived;
+template<typename Derived, typename Operation, typename LHS, typename RHS>
+auto deduce_derived(node<Derived, Operation, LHS, RHS> const &) -> Derived;
+
+// A value of a type that derives from `operators::expression`, or an
+// unevaluated combination of them
+template<typename T>
+concept operand = requires(T const & value) { ::operators_impl::expression::deduce_derived(value); };
+
+template<operand T>
+using derived_t = decltype(::operators_impl::expression::deduce_derived(std::declval<T const &>()));
+
+template<typename T>
+concept leaf = operand<T> and std::same_as<T, derived_t<T>>;
+
+template<typename T>
+concept scalar = std::is_arithmetic_v<T>;
+
+template<typename T, typename Derived>
+concept operand_of = scalar<T> or (operand<T> and std::same_as<derived_t<T>, Derived>);
+
+template<typename LHS, typename RHS>
+concept combinable =
+	(operand<LHS> and operand_of<RHS, derived_t<LHS>>) or
+	(scalar<LHS> and operand<RHS>);
+
+template<typename LHS, typename RHS>
+using common_derived_t = derived_t<std::conditional_t<operand<LHS>, LHS, RHS>>;
+
+// A node refers to the values it was built from if they are lvalues, so that
+// building it copies no elements. Temporaries are moved into the node so that
+// it does not outlive them.
+template<typename T>
+using stored_t = std::conditional_t<
+	std::is_lvalue_reference_v<T> and leaf<std::remove_cvref_t<T>>,
+	std::remove_cvref_t<T> const &,
+	std::remove_cvref_t<T>
+>;
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto first_leaf(auto const & value) -> auto const & {
+	using value_t = std::remove_cvref_t<decltype(value)>;
+	if constexpr (leaf<value_t>) {
+		return value;
+	} else if constexpr (operand<std::remove_cvref_t<decltype(value.lhs)>>) {
+		return ::operators_impl::expression::first_leaf(value.lhs);
+	} else {
+		return ::operators_impl::expression::first_leaf(value.rhs);
+	}
+}
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto element(auto const & value, std::size_t const index) -> decltype(auto) {
+	if constexpr (scalar<std::remove_cvref_t<decltype(value)>>) {
+		return value;
+	} else {
+		return value[index];
+	}
+}
+
+// Every element of the expression is computed once, directly into `lhs`, so no
+// temporary is allocated and each operand is read from memory once. Element
+// `index` of `rhs` depends only on element `index` of each operand, so this is
+// correct even if `lhs` is one of them.
+template<typename Derived>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto evaluate_into(Derived & lhs, auto const & rhs, auto const operation) -> void {
+	auto const size = static_cast<std::size_t>(std::ranges::size(lhs));
+	for (std::size_t index = 0; index != size; ++index) {
+		lhs[index] = operation(lhs[index], ::operators_impl::expression::element(rhs, index));
+	}
+}
+
+template<typename Derived, typename Operation, typename LHS, typename RHS>
+struct node {
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator[](std::size_t const index) const -> decltype(auto) {
+		return Operation()(
+			::operators_impl::expression::element(lhs, index),
+			::operators_impl::expression::element(rhs, index)
+		);
+	}
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto size() const {
+		return std::ranges::size(::operators_impl::expression::first_leaf(*this));
+	}
+
+	// Copies the first value in the expression to get a result of the right
+	// size and then overwrites each element.
+	constexpr operator Derived() const {
+		auto result = Derived(::operators_impl::expression::first_leaf(*this));
+		::operators_impl::expression::evaluate_into(result, *this, [](auto const &, auto const & value) { return value; });
+		return result;
+	}
+
+	LHS lhs;
+	RHS rhs;
+};
+
+#define OPERATORS_DETAIL_EXPRESSION_OPERATOR(symbol, operation) \
+	export template<typename LHS, typename RHS> requires combinable<std::remove_cvref_t<LHS>, std::remove_cvref_t<RHS>> \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator symbol(LHS && lhs, RHS && rhs) \
+		-> node<common_derived_t<std::remove_cvref_t<LHS>, std::remove_cvref_t<RHS>>, operation, stored_t<LHS>, stored_t<RHS>> \
+	{ \
+		return {OPERATORS_FORWARD(lhs), OPERATORS_FORWARD(rhs)}; \
+	}
+
+OPERATORS_DETAIL_EXPRESSION_OPERATOR(+, std::plus<>)
+OPERATORS_DETAIL_EXPRESSION_OPERATOR(-, std::minus<>)
+OPERATORS_DETAIL_EXPRESSION_OPERATOR(*, std::multiplies<>)
+OPERATORS_DETAIL_EXPRESSION_OPERATOR(/, std::divides<>)
+
+#define OPERATORS_DETAIL_EXPRESSION_IN_PLACE(in_place, operation) \
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto in_place(Derived & lhs, operand_of<Derived> auto const & rhs) -> void { \
+		::operators_impl::expression::evaluate_into(lhs, rhs, operation()); \
+	}
+
+template<typename Derived>
+struct base : operators::compound_assignment {
+	OPERATORS_DETAIL_EXPRESSION_IN_PLACE(add_in_place, std::plus<>)
+	OPERATORS_DETAIL_EXPRESSION_IN_PLACE(subtract_in_place, std::minus<>)
+	OPERATORS_DETAIL_EXPRESSION_IN_PLACE(multiply_in_place, std::multiplies<>)
+	OPERATORS_DETAIL_EXPRESSION_IN_PLACE(divide_in_place, std::divides<>)
+
+	friend auto operator<=>(base, base) = default;
+};
+
+} // namespace operators_impl::expression
+
+namespace operators {
+
+// `Derived` is a sequence of numbers with `value[index]`, `std::ranges::size`,
+// and a copy constructor. `+`, `-`, `*`, and `/` on it, and on combinations of
+// it with other such expressions and with arithmetic scalars, return a node
+// that computes each element when asked for it. A node converts to `Derived`,
+// and `add_in_place` and friends accept it. `base` derives from
+// `operators::compound_assignment`, so `+=` and friends evaluate the whole
+// expression in one loop.
+export template<typename Derived>
+using expression = operators_impl::expression::base<Derived>;
+
+} // namespace operators
+
+namespace {
+
+struct values : operators::expression<values> {
+	constexpr explicit values(std::array<int, 3> const elements_, int * const copies_ = nullptr):
+		elements(elements_),
+		copies(copies_)
+	{
+	}
+	constexpr values(values const & other):
+		elements(other.elements),
+		copies(other.copies)
+	{
+		if (copies) {
+			++*copies;
+		}
+	}
+	values(values &&) = default;
+	auto operator=(values const &) & -> values & = default;
+	auto operator=(values &&) & -> values & = default;
+
+	constexpr auto operator[](std::size_t const index) const -> int const & {
+		return elements[index];
+	}
+	constexpr auto operator[](std::size_t const index) -> int & {
+		return elements[index];
+	}
+	constexpr auto size() const -> std::size_t {
+		return elements.size();
+	}
+
+	std::array<int, 3> elements;
+	int * copies;
+};
+
+struct other_values : operators::expression<other_values> {
+	constexpr auto operator[](std::size_t) const -> int {
+		return 0;
+	}
+	constexpr auto size() const -> std::size_t {
+		return 3;
+	}
+};
+
+template<typename LHS, typename RHS>
+concept addable = requires(LHS const & lhs, RHS const & rhs) { lhs + rhs; };
+
+static_assert(addable<values, values>);
+static_assert(addable<values, int>);
+static_assert(addable<double, values>);
+static_assert(!addable<values, other_values>);
+
+using operators_impl::expression::node;
+
+static_assert(std::same_as<
+	decltype(std::declval<values const &>() * std::declval<values const &>()),
+	node<values, std::multiplies<>, values const &, values const &>
+>);
+static_assert(std::same_as<
+	decltype(std::declval<values>() - 1),
+	node<values, std::minus<>, values, int>
+>);
+
+constexpr auto evaluates_in_place() -> bool {
+	auto copies = 0;
+	auto a = values({1, 2, 3}, &copies);
+	auto const b = values({2, 3, 4}, &copies);
+	auto const c = values({3, 4, 5}, &copies);
+	auto const d = values({4, 5, 6}, &copies);
+	a += b * c - d;
+	a -= 2 * b;
+	return a.elements == std::array{-1, 3, 9} and copies == 0;
+}
+static_assert(evaluates_in_place());
+
+constexpr auto converts() -> bool {
+	auto copies = 0;
+	auto const a = values({1, 2, 3}, &copies);
+	auto const b = values({4, 5, 6}, &copies);
+	values const result = 10 - (a + b * 2) / 3;
+	return result.elements == std::array{7, 6, 5} and copies == 1;
+}
+static_assert(converts());
+
+constexpr auto compound_with_scalar() -> bool {
+	auto a = values({1, 2, 3});
+	a *= 4;
+	a /= 2;
+	a += a;
+	return a.elements == std::array{4, 8, 12};
+}
+static_assert(compound_with_scalar());
+
+} // namespace
@@ -5,22 +5,73 @@
 
 module;
 
+#include <operators/force_inline.hpp>
+#include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 export module operators.increment_decrement;
 
+export import operators.constant;
 import std_module;
 
 #define OPERATORS_PREFIX_INCREMENT_DEFINITION \
-	constexpr auto operator++(auto & value) OPERATORS_RETURNS( \
-		value += 1 \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator++(::operators::detail::one_addable auto & value) OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(prefix_increment, \
+		::operators::detail::add_one(value) \
 	)
 
 #define OPERATORS_PREFIX_DECREMENT_DEFINITION \
-	constexpr auto operator--(auto & value) OPERATORS_RETURNS( \
-		value -= 1 \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator--(::operators::detail::one_subtractable auto & value) OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(prefix_decrement, \
+		::operators::detail::subtract_one(value) \
 	)
 
+namespace operators::detail {
+
+// A const operand is rejected before `+=` or `-=` is looked up for it.
+template<typename T>
+concept one_addable = !std::is_const_v<T> and (
+	requires(T & value) { value += ::operators::one(); } or
+	requires(T & value) { value += 1; }
+);
+
+template<typename T>
+concept one_subtractable = !std::is_const_v<T> and (
+	requires(T & value) { value -= ::operators::one(); } or
+	requires(T & value) { value -= 1; }
+);
+
+// The generated `++a` is `a += operators::one()` if that is valid, and otherwise
+// `a += 1`. A type that can increment faster than it can add an arbitrary value,
+// such as a big integer that only needs to propagate a carry, can overload its
+// `+=` (or `+`, `add_in_place`, and so on for the generated `+=`) for `one`.
+// `one` converts to `int`, so this calls the same function as `a += 1` for types
+// that accept an `int` and do not overload for it.
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto add_one(auto & value) OPERATORS_RETURNS_NOEXCEPT(
+	value += 1
+)
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto add_one(auto & value)
+	noexcept(noexcept(value += ::operators::one()) and OPERATORS_DETAIL_NOTHROW_RETURNABLE(value += ::operators::one()))
+	-> decltype(value += ::operators::one())
+	requires requires { value += ::operators::one(); }
+{
+	return value += ::operators::one();
+}
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto subtract_one(auto & value) OPERATORS_RETURNS_NOEXCEPT(
+	value -= 1
+)
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto subtract_one(auto & value)
+	noexcept(noexcept(value -= ::operators::one()) and OPERATORS_DETAIL_NOTHROW_RETURNABLE(value -= ::operators::one()))
+	-> decltype(value -= ::operators::one())
+	requires requires { value -= ::operators::one(); }
+{
+	return value -= ::operators::one();
+}
+
+} // namespace operators::detail
+
 namespace operators {
 
 template<typename T>
@@ -29,41 +80,135 @@ concept prefix_incrementable = requires(T value) { ++value; };
 template<typename T>
 concept prefix_decrementable = requires(T value) { --value; };
 
+// What the generated postfix operators return. The previous value is often
+// discarded, and for types that are expensive to copy, such as big integers or
+// iterators that hold a lot of state, the copy is not free.
+export enum class postfix_return {
+	// A copy of the value from before the operation, or `void` if `T` cannot be
+	// copied
+	copy,
+	// `value - 1` after incrementing and `value + 1` after decrementing. The
+	// previous value is computed from the new value after the operation, so
+	// nothing is kept alive across it and the computation can be removed when
+	// the result is unused. `T` does not need to be copyable. For a type without
+	// those, such as a bidirectional iterator, this is a copy of the new value
+	// that is then decremented or incremented, or `void` if `T` cannot be
+	// copied.
+	inverse,
+	// `void`
+	none,
+};
+
+// Specialize this for a type to choose what its generated postfix operators
+// return.
+export template<typename T>
+inline constexpr auto postfix_return_policy = postfix_return::copy;
+
 // Work around https://github.com/llvm/llvm-project/issues/95280
 
-template<std::copy_constructible T>
-constexpr auto postfix_increment_impl(T & value) -> T {
+template<std::copy_constructible T> requires(postfix_return_policy<T> == postfix_return::copy)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_increment_impl(T & value) noexcept(
+	std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_move_constructible_v<T> and noexcept(++value)
+) -> T {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_increment);
+	OPERATORS_DETAIL_RECORD_COPY(postfix_increment);
 	auto previous = value;
 	++value;
 	return previous;
 }
 
 template<typename T>
-constexpr auto postfix_increment_impl(T & value) -> void {
+concept one_less_constructible = requires(T const & value) { static_cast<T>(value - 1); };
+
+template<typename T>
+concept one_more_constructible = requires(T const & value) { static_cast<T>(value + 1); };
+
+template<one_less_constructible T> requires(postfix_return_policy<T> == postfix_return::inverse)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_increment_impl(T & value) noexcept(
+	noexcept(++value) and noexcept(static_cast<T>(std::as_const(value) - 1))
+) -> T {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_increment);
+	++value;
+	return static_cast<T>(std::as_const(value) - 1);
+}
+
+template<std::copy_constructible T> requires(
+	postfix_return_policy<T> == postfix_return::inverse and
+	!one_less_constructible<T> and
+	prefix_decrementable<T>
+)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_increment_impl(T & value) noexcept(
+	std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_move_constructible_v<T> and noexcept(++value) and noexcept(--value)
+) -> T {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_increment);
+	OPERATORS_DETAIL_RECORD_COPY(postfix_increment);
+	++value;
+	auto previous = value;
+	--previous;
+	return previous;
+}
+
+template<typename T>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_increment_impl(T & value) noexcept(noexcept(++value)) -> void {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_increment);
 	++value;
 }
 
-template<std::copy_constructible T>
-constexpr auto postfix_decrement_impl(T & value) -> T {
+template<std::copy_constructible T> requires(postfix_return_policy<T> == postfix_return::copy)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_decrement_impl(T & value) noexcept(
+	std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_move_constructible_v<T> and noexcept(--value)
+) -> T {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_decrement);
+	OPERATORS_DETAIL_RECORD_COPY(postfix_decrement);
 	auto previous = value;
 	--value;
 	return previous;
 }
 
+template<one_more_constructible T> requires(postfix_return_policy<T> == postfix_return::inverse)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_decrement_impl(T & value) noexcept(
+	noexcept(--value) and noexcept(static_cast<T>(std::as_const(value) + 1))
+) -> T {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_decrement);
+	--value;
+	return static_cast<T>(std::as_const(value) + 1);
+}
+
+template<std::copy_constructible T> requires(
+	postfix_return_policy<T> == postfix_return::inverse and
+	!one_more_constructible<T> and
+	prefix_incrementable<T>
+)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_decrement_impl(T & value) noexcept(
+	std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_move_constructible_v<T> and noexcept(--value) and noexcept(++value)
+) -> T {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_decrement);
+	OPERATORS_DETAIL_RECORD_COPY(postfix_decrement);
+	--value;
+	auto next = value;
+	++next;
+	return next;
+}
+
 template<typename T>
-constexpr auto postfix_decrement_impl(T & value) -> void {
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto postfix_decrement_impl(T & value) noexcept(noexcept(--value)) -> void {
+	OPERATORS_DETAIL_RECORD_CALL(postfix_decrement);
 	--value;
 }
 
 } // namespace operators
 
 #define OPERATORS_POSTFIX_INCREMENT_DEFINITION \
-	constexpr auto operator++(operators::prefix_incrementable auto & value, int) { \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator++(operators::prefix_incrementable auto & value, int) noexcept( \
+		noexcept(::operators::postfix_increment_impl(value)) \
+	) { \
 		return ::operators::postfix_increment_impl(value); \
 	}
 
 #define OPERATORS_POSTFIX_DECREMENT_DEFINITION \
-	constexpr auto operator--(operators::prefix_decrementable auto & value, int) { \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator--(operators::prefix_decrementable auto & value, int) noexcept( \
+		noexcept(::operators::postfix_decrement_impl(value)) \
+	) { \
 		return ::operators::postfix_decrement_impl(value); \
 	}
 
@@ -139,6 +284,34 @@ struct impl {
 };
 }
 
+// `++value` and so on as function objects, for algorithms that take one. Like
+// the compound assignment function objects, these are outside of `operators`
+// so that they find the same operators as the caller's own code.
+struct pre_increment_fn {
+	using is_transparent = void;
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator()(auto && value) const OPERATORS_RETURNS_NOEXCEPT(
+		++OPERATORS_FORWARD(value)
+	)
+};
+struct post_increment_fn {
+	using is_transparent = void;
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator()(auto && value) const OPERATORS_RETURNS_NOEXCEPT(
+		OPERATORS_FORWARD(value)++
+	)
+};
+struct pre_decrement_fn {
+	using is_transparent = void;
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator()(auto && value) const OPERATORS_RETURNS_NOEXCEPT(
+		--OPERATORS_FORWARD(value)
+	)
+};
+struct post_decrement_fn {
+	using is_transparent = void;
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator()(auto && value) const OPERATORS_RETURNS_NOEXCEPT(
+		OPERATORS_FORWARD(value)--
+	)
+};
+
 } // namespace operators_impl
 
 namespace operators {
@@ -169,6 +342,11 @@ export using increment = operators_impl::increment::impl;
 export using decrement = operators_impl::decrement::impl;
 export using increment_decrement = operators_impl::all::impl;
 
+export using pre_increment_fn = operators_impl::pre_increment_fn;
+export using post_increment_fn = operators_impl::post_increment_fn;
+export using pre_decrement_fn = operators_impl::pre_decrement_fn;
+export using post_decrement_fn = operators_impl::post_decrement_fn;
+
 } // namespace operators
 
 namespace {
@@ -228,8 +406,79 @@ static_assert(test_increment_decrement(s(5), s(6), s(5), postfix_increment));
 static_assert(test_increment_decrement(s(5), s(4), s(4), prefix_decrement));
 static_assert(test_increment_decrement(s(5), s(4), s(5), postfix_decrement));
 
+static_assert(test_increment_decrement(s(5), s(6), s(6), operators::pre_increment_fn()));
+static_assert(test_increment_decrement(s(5), s(6), s(5), operators::post_increment_fn()));
+static_assert(test_increment_decrement(s(5), s(4), s(4), operators::pre_decrement_fn()));
+static_assert(test_increment_decrement(s(5), s(4), s(5), operators::post_decrement_fn()));
+static_assert(test_increment_decrement(5, 6, 5, operators::post_increment_fn()));
+static_assert(!std::invocable<operators::pre_increment_fn, s const &>);
+static_assert(std::is_empty_v<operators::post_decrement_fn>);
+
+// The `+=` and `-=` of `s` deduce their return types, so checking them with a
+// const operand would be a hard error rather than a substitution failure
+static_assert(!has_increment<s const>);
+static_assert(!has_decrement<s const>);
+static_assert(operators::detail::one_addable<s>);
+static_assert(!operators::detail::one_addable<s const>);
+static_assert(operators::detail::one_subtractable<s>);
+static_assert(!operators::detail::one_subtractable<s const>);
+
 } // namespace base_all
 
+namespace nothrow {
+
+struct s : private operators::increment_decrement {
+	constexpr explicit s(int value_):
+		value(value_)
+	{
+	}
+
+	friend constexpr auto & operator+=(auto & lhs, int rhs) noexcept {
+		lhs.value += rhs;
+		return lhs;
+	}
+	friend constexpr auto & operator-=(auto & lhs, int rhs) {
+		lhs.value -= rhs;
+		return lhs;
+	}
+
+private:
+	int value;
+};
+
+static_assert(noexcept(++std::declval<s &>()));
+static_assert(noexcept(std::declval<s &>()++));
+static_assert(!noexcept(--std::declval<s &>()));
+static_assert(!noexcept(std::declval<s &>()--));
+
+} // namespace nothrow
+
+namespace throwing_copy {
+
+struct s : private operators::increment {
+	constexpr explicit s(int value_):
+		value(value_)
+	{
+	}
+	constexpr s(s const & other) noexcept(false):
+		value(other.value)
+	{
+	}
+
+	friend constexpr auto & operator+=(auto & lhs, int rhs) noexcept {
+		lhs.value += rhs;
+		return lhs;
+	}
+
+private:
+	int value;
+};
+
+static_assert(noexcept(++std::declval<s &>()));
+static_assert(!noexcept(std::declval<s &>()++));
+
+} // namespace throwing_copy
+
 namespace base_increment {
 
 struct s : private operators::increment {
@@ -765,4 +1014,239 @@ static_assert(!has_increment<declarations_postfix_decrement::s>);
 static_assert(test_increment_decrement(declarations_postfix_decrement::s(5), declarations_postfix_decrement::s(4), declarations_postfix_decrement::s(4), prefix_decrement));
 static_assert(test_increment_decrement(declarations_postfix_decrement::s(5), declarations_postfix_decrement::s(4), declarations_postfix_decrement::s(5), postfix_decrement));
 
+namespace unit_constant {
+
+// Counts how often `+=` and `-=` were called with `operators::one` rather than
+// with an `int`
+struct s : private operators::increment_decrement {
+	constexpr explicit s(int value_):
+		value(value_)
+	{
+	}
+
+	friend constexpr auto operator+=(s & lhs, int rhs) -> s & {
+		lhs.value += rhs;
+		return lhs;
+	}
+	friend constexpr auto operator+=(s & lhs, operators::one) -> s & {
+		++lhs.value;
+		++lhs.unit_operations;
+		return lhs;
+	}
+	friend constexpr auto operator-=(s & lhs, int rhs) -> s & {
+		lhs.value -= rhs;
+		return lhs;
+	}
+	friend constexpr auto operator-=(s & lhs, operators::one) -> s & {
+		--lhs.value;
+		++lhs.unit_operations;
+		return lhs;
+	}
+
+	int value;
+	int unit_operations = 0;
+};
+
+constexpr auto uses_unit_overloads() -> bool {
+	auto value = s(5);
+	++value;
+	value++;
+	--value;
+	value--;
+	return value.value == 5 and value.unit_operations == 4;
+}
+static_assert(uses_unit_overloads());
+
+// `operators::one` converts to `int`, but not on to `implicit`, so this falls
+// back to `+= 1`
+struct implicit : private operators::increment_decrement {
+	constexpr implicit(int value_):
+		value(value_)
+	{
+	}
+
+	friend constexpr auto operator+=(implicit & lhs, implicit const rhs) -> implicit & {
+		lhs.value += rhs.value;
+		return lhs;
+	}
+	friend constexpr auto operator-=(implicit & lhs, implicit const rhs) -> implicit & {
+		lhs.value -= rhs.value;
+		return lhs;
+	}
+	friend auto operator==(implicit, implicit) -> bool = default;
+
+	int value;
+};
+
+template<typename T>
+concept unit_addable = requires(T & value) { value += operators::one(); };
+
+static_assert(unit_addable<s>);
+static_assert(!unit_addable<implicit>);
+static_assert(test_increment_decrement(implicit(5), implicit(6), implicit(6), prefix_increment));
+static_assert(test_increment_decrement(implicit(5), implicit(6), implicit(5), postfix_increment));
+static_assert(test_increment_decrement(implicit(5), implicit(4), implicit(4), prefix_decrement));
+static_assert(test_increment_decrement(implicit(5), implicit(4), implicit(5), postfix_decrement));
+
+} // namespace unit_constant
+
+namespace postfix_none {
+
+struct s : private operators::increment_decrement {
+	constexpr explicit s(int value_):
+		value(value_)
+	{
+	}
+
+	friend constexpr auto & operator+=(auto & lhs, int rhs) {
+		lhs.value += rhs;
+		return lhs;
+	}
+	friend constexpr auto & operator-=(auto & lhs, int rhs) {
+		lhs.value -= rhs;
+		return lhs;
+	}
+
+	friend auto operator==(s, s) -> bool = default;
+private:
+	int value;
+};
+
+} // namespace postfix_none
+
+namespace postfix_inverse {
+
+// Cannot be copied, so the previous value must be computed from the new one
+struct s : private operators::increment_decrement {
+	constexpr explicit s(int value_):
+		value(value_)
+	{
+	}
+	s(s const &) = delete;
+	auto operator=(s const &) -> s & = delete;
+
+	friend constexpr auto operator+=(s & lhs, int rhs) -> s & {
+		lhs.value += rhs;
+		return lhs;
+	}
+	friend constexpr auto operator-=(s & lhs, int rhs) -> s & {
+		lhs.value -= rhs;
+		return lhs;
+	}
+	friend constexpr auto operator+(s const & lhs, int rhs) -> s {
+		return s(lhs.value + rhs);
+	}
+	friend constexpr auto operator-(s const & lhs, int rhs) -> s {
+		return s(lhs.value - rhs);
+	}
+
+	int value;
+};
+
+struct node {
+	int value;
+	node * previous;
+	node * next;
+};
+
+// A bidirectional iterator, which has no `+` or `-`
+struct list_iterator : private operators::postfix::increment_decrement {
+	using value_type = int;
+	using difference_type = std::ptrdiff_t;
+
+	list_iterator() = default;
+	constexpr explicit list_iterator(node * const position_):
+		position(position_)
+	{
+	}
+
+	constexpr auto operator*() const -> int & {
+		return position->value;
+	}
+	constexpr auto operator++() -> list_iterator & {
+		position = position->next;
+		return *this;
+	}
+	constexpr auto operator--() -> list_iterator & {
+		position = position->previous;
+		return *this;
+	}
+
+	friend auto operator==(list_iterator, list_iterator) -> bool = default;
+
+private:
+	node * position = nullptr;
+};
+
+} // namespace postfix_inverse
+
+} // namespace
+
+template<>
+inline constexpr auto operators::postfix_return_policy<postfix_none::s> = operators::postfix_return::none;
+
+template<>
+inline constexpr auto operators::postfix_return_policy<postfix_inverse::s> = operators::postfix_return::inverse;
+
+template<>
+inline constexpr auto operators::postfix_return_policy<postfix_inverse::list_iterator> = operators::postfix_return::inverse;
+
+namespace {
+namespace postfix_none {
+
+static_assert(std::same_as<decltype(std::declval<s &>()++), void>);
+static_assert(std::same_as<decltype(std::declval<s &>()--), void>);
+static_assert(test_increment_decrement(s(5), s(6), s(6), prefix_increment));
+static_assert(test_increment_decrement(s(5), s(4), s(4), prefix_decrement));
+
+constexpr auto postfix_updates() -> bool {
+	auto value = s(5);
+	value++;
+	value++;
+	value--;
+	return value == s(6);
+}
+static_assert(postfix_updates());
+
+} // namespace postfix_none
+
+namespace postfix_inverse {
+
+static_assert(!std::copy_constructible<s>);
+static_assert(std::same_as<decltype(std::declval<s &>()++), s>);
+static_assert(std::same_as<decltype(std::declval<s &>()--), s>);
+
+constexpr auto returns_previous() -> bool {
+	auto value = s(5);
+	auto const incremented = value++;
+	if (incremented.value != 5 or value.value != 6) {
+		return false;
+	}
+	auto const decremented = value--;
+	return decremented.value == 6 and value.value == 5;
+}
+static_assert(returns_previous());
+
+static_assert(!operators::one_less_constructible<list_iterator>);
+static_assert(!operators::one_more_constructible<list_iterator>);
+static_assert(std::bidirectional_iterator<list_iterator>);
+static_assert(!std::random_access_iterator<list_iterator>);
+
+constexpr auto bidirectional_returns_previous() -> bool {
+	auto nodes = std::array<node, 3>{{{1, nullptr, nullptr}, {2, nullptr, nullptr}, {3, nullptr, nullptr}}};
+	nodes[0].next = &nodes[1];
+	nodes[1].previous = &nodes[0];
+	nodes[1].next = &nodes[2];
+	nodes[2].previous = &nodes[1];
+	auto it = list_iterator(&nodes[0]);
+	auto const incremented = it++;
+	if (*incremented != 1 or *it != 2) {
+		return false;
+	}
+	auto const decremented = it--;
+	return *decremented == 2 and *it == 1;
+}
+static_assert(bidirectional_returns_previous());
+
+} // namespace postfix_inverse
 } // namespace
\ No newline at end of file
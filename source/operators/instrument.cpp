@@ -0,0 +1,152 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module operators.instrument;
+
+import std_module;
+
+// Counters for finding where generated operators copy or move in a running
+// program. They are only updated if `OPERATORS_INSTRUMENT` is defined; see
+// `operators/instrument.hpp`.
+
+namespace operators::instrument {
+
+export enum class operation {
+	plus_equal,
+	minus_equal,
+	times_equal,
+	divides_equal,
+	modulo_equal,
+	left_shift_equal,
+	right_shift_equal,
+	and_equal,
+	or_equal,
+	xor_equal,
+	prefix_increment,
+	prefix_decrement,
+	postfix_increment,
+	postfix_decrement,
+	unary_plus,
+	unary_minus,
+	binary_minus,
+	arrow,
+	arrow_star,
+	bracket,
+};
+
+constexpr auto operation_count = static_cast<std::size_t>(operation::bracket) + 1;
+
+export constexpr auto to_string(operation const op) -> std::string_view {
+	switch (op) {
+		case operation::plus_equal: return "+=";
+		case operation::minus_equal: return "-=";
+		case operation::times_equal: return "*=";
+		case operation::divides_equal: return "/=";
+		case operation::modulo_equal: return "%=";
+		case operation::left_shift_equal: return "<<=";
+		case operation::right_shift_equal: return ">>=";
+		case operation::and_equal: return "&=";
+		case operation::or_equal: return "|=";
+		case operation::xor_equal: return "^=";
+		case operation::prefix_increment: return "prefix ++";
+		case operation::prefix_decrement: return "prefix --";
+		case operation::postfix_increment: return "postfix ++";
+		case operation::postfix_decrement: return "postfix --";
+		case operation::unary_plus: return "unary +";
+		case operation::unary_minus: return "unary -";
+		case operation::binary_minus: return "binary -";
+		case operation::arrow: return "->";
+		case operation::arrow_star: return "->*";
+		case operation::bracket: return "[]";
+	}
+	std::unreachable();
+}
+
+// `copies` and `moves` count only the objects that the generated operator
+// itself constructs or assigns, not anything done by the user-defined
+// operations that it calls.
+export struct counts {
+	std::uint64_t calls = 0;
+	std::uint64_t copies = 0;
+	std::uint64_t moves = 0;
+
+	friend auto operator==(counts, counts) -> bool = default;
+};
+
+// Not inline, so importers see only a function call and not the definition of
+// a thread_local variable
+auto counters() noexcept -> std::array<counts, operation_count> & {
+	thread_local constinit auto result = std::array<counts, operation_count>();
+	return result;
+}
+
+// The counts for the calling thread since it started or last called `reset`
+export auto count(operation const op) -> counts {
+	return counters()[static_cast<std::size_t>(op)];
+}
+
+export auto reset() -> void {
+	counters() = {};
+}
+
+// Writes one JSON object per line for each operation used on the calling
+// thread, in the same form as the benchmark output.
+export auto dump(std::ostream & stream) -> void {
+	for (std::size_t index = 0; index != operation_count; ++index) {
+		auto const & current = counters()[index];
+		if (current == counts()) {
+			continue;
+		}
+		stream
+			<< R"({"operation":")" << to_string(static_cast<operation>(index))
+			<< R"(","calls":)" << current.calls
+			<< R"(,"copies":)" << current.copies
+			<< R"(,"moves":)" << current.moves
+			<< "}\n";
+	}
+}
+
+} // namespace operators::instrument
+
+namespace operators::instrument::detail {
+
+// Generated operators are usable in constant expressions, which cannot touch a
+// thread_local variable, so these only count at run time.
+export constexpr auto record_call(operation const op) noexcept -> void {
+	if !consteval {
+		++counters()[static_cast<std::size_t>(op)].calls;
+	}
+}
+
+export constexpr auto record_copy(operation const op) noexcept -> void {
+	if !consteval {
+		++counters()[static_cast<std::size_t>(op)].copies;
+	}
+}
+
+export constexpr auto record_move(operation const op) noexcept -> void {
+	if !consteval {
+		++counters()[static_cast<std::size_t>(op)].moves;
+	}
+}
+
+} // namespace operators::instrument::detail
+
+namespace {
+
+using namespace operators::instrument;
+
+static_assert(to_string(operation::plus_equal) == "+=");
+static_assert(to_string(operation::bracket) == "[]");
+
+constexpr auto recorded_at_compile_time() -> bool {
+	detail::record_call(operation::plus_equal);
+	detail::record_copy(operation::plus_equal);
+	detail::record_move(operation::plus_equal);
+	return true;
+}
+static_assert(recorded_at_compile_time());
+
+} // namespace
@@ -0,0 +1,244 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+module;
+
+#include <operators/force_inline.hpp>
+#include <operators/returns.hpp>
+
+export module operators.iterator_facade;
+
+import operators.binary_minus;
+import operators.bracket;
+import operators.compound_assignment;
+import operators.increment_decrement;
+import std_module;
+
+// Not proposed for standardization
+
+namespace operators::detail {
+
+// `std::to_address(it)` calls `it.operator->()`, which must be valid for
+// iterators that cannot be dereferenced, such as the end of a range. An
+// iterator that knows the address of its element says so with `to_address`.
+template<typename Iterator>
+concept exposes_to_address = requires(Iterator const & it) { it.to_address(); };
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto iterator_arrow(exposes_to_address auto const & it) OPERATORS_RETURNS_NOEXCEPT(
+	it.to_address()
+)
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto iterator_arrow(auto const & it) OPERATORS_RETURNS_NOEXCEPT(
+	std::addressof(*it)
+)
+
+} // namespace operators::detail
+
+namespace operators_impl {
+
+// `Derived` defines `*it`, `it + offset` (or `add_in_place(it, offset)`), and
+// `lhs - rhs`. This adds `+=`, `-=`, `++`, `--`, `offset + it`, `it - offset`,
+// `it[offset]`, `->`, `==`, and `<=>`, and `std::iterator_traits` below
+// supplies the member types.
+//
+// The comparisons are templates so that any comparison `Derived` defines
+// itself is preferred.
+template<typename Derived>
+struct iterator_facade :
+	operators::plus_equal,
+	operators::minus_equal,
+	operators::increment_decrement,
+	operators::binary::minus,
+	operators::iterator_bracket<Derived>
+{
+	template<typename D = Derived>
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator->() const OPERATORS_RETURNS_NOEXCEPT(
+		::operators::detail::iterator_arrow(static_cast<D const &>(*this))
+	)
+
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto operator+(std::integral auto const offset, Derived const & it) OPERATORS_RETURNS_NOEXCEPT(
+		it + offset
+	)
+
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto operator==(std::same_as<Derived> auto const & lhs, std::same_as<Derived> auto const & rhs) OPERATORS_RETURNS_NOEXCEPT(
+		lhs - rhs == 0
+	)
+	OPERATORS_DETAIL_FORCE_INLINE friend constexpr auto operator<=>(std::same_as<Derived> auto const & lhs, std::same_as<Derived> auto const & rhs) OPERATORS_RETURNS_NOEXCEPT(
+		lhs - rhs <=> 0
+	)
+
+	friend auto operator<=>(iterator_facade, iterator_facade) = default;
+};
+
+} // namespace operators_impl
+
+namespace operators {
+
+export template<typename Derived>
+using iterator_facade = operators_impl::iterator_facade<Derived>;
+
+} // namespace operators
+
+namespace operators::detail {
+
+template<typename Iterator>
+struct iterator_facade_pointer {
+	using type = void;
+};
+
+template<typename Iterator> requires requires(Iterator const & it) { it.operator->(); }
+struct iterator_facade_pointer<Iterator> {
+	using type = decltype(std::declval<Iterator const &>().operator->());
+};
+
+} // namespace operators::detail
+
+// The member types depend on `Derived`, which is incomplete while its bases
+// are instantiated, so they cannot be members of `iterator_facade`. Specializing
+// `iterator_traits` defers them until something asks.
+template<typename Iterator> requires std::is_base_of_v<operators_impl::iterator_facade<Iterator>, Iterator>
+struct std::iterator_traits<Iterator> {
+	using reference = decltype(*std::declval<Iterator const &>());
+	using value_type = std::remove_cvref_t<reference>;
+	using difference_type = decltype(std::declval<Iterator const &>() - std::declval<Iterator const &>());
+	using pointer = typename operators::detail::iterator_facade_pointer<Iterator>::type;
+	using iterator_category = std::conditional_t<
+		std::is_lvalue_reference_v<reference>,
+		std::random_access_iterator_tag,
+		std::input_iterator_tag
+	>;
+	using iterator_concept = std::conditional_t<
+		std::is_lvalue_reference_v<reference> and operators::detail::exposes_to_address<Iterator>,
+		std::contiguous_iterator_tag,
+		std::random_access_iterator_tag
+	>;
+};
+
+namespace {
+
+template<typename T>
+struct random_access : operators::iterator_facade<random_access<T>> {
+	random_access() = default;
+	constexpr explicit random_access(T * pointer_):
+		pointer(pointer_)
+	{
+	}
+
+	constexpr auto operator*() const -> T & {
+		return *pointer;
+	}
+	friend constexpr auto operator+(random_access const it, std::ptrdiff_t const offset) -> random_access {
+		return random_access(it.pointer + offset);
+	}
+	friend constexpr auto operator-(random_access const lhs, random_access const rhs) -> std::ptrdiff_t {
+		return lhs.pointer - rhs.pointer;
+	}
+
+private:
+	T * pointer = nullptr;
+};
+
+template<typename T>
+struct contiguous : operators::iterator_facade<contiguous<T>> {
+	contiguous() = default;
+	constexpr explicit contiguous(T * pointer_):
+		pointer(pointer_)
+	{
+	}
+
+	constexpr auto operator*() const -> T & {
+		return *pointer;
+	}
+	constexpr auto to_address() const -> T * {
+		return pointer;
+	}
+	friend constexpr auto operator+(contiguous const it, std::ptrdiff_t const offset) -> contiguous {
+		return contiguous(it.pointer + offset);
+	}
+	friend constexpr auto operator-(contiguous const lhs, contiguous const rhs) -> std::ptrdiff_t {
+		return lhs.pointer - rhs.pointer;
+	}
+
+private:
+	T * pointer = nullptr;
+};
+
+struct counting : operators::iterator_facade<counting> {
+	counting() = default;
+	constexpr explicit counting(int value_):
+		value(value_)
+	{
+	}
+
+	constexpr auto operator*() const -> int {
+		return value;
+	}
+	friend constexpr auto add_in_place(counting & it, std::ptrdiff_t const offset) -> void {
+		it.value += static_cast<int>(offset);
+	}
+	friend constexpr auto operator+(counting it, std::ptrdiff_t const offset) -> counting {
+		it += offset;
+		return it;
+	}
+	friend constexpr auto operator-(counting const lhs, counting const rhs) -> std::ptrdiff_t {
+		return lhs.value - rhs.value;
+	}
+
+private:
+	int value = 0;
+};
+
+static_assert(std::random_access_iterator<random_access<int>>);
+static_assert(!std::contiguous_iterator<random_access<int>>);
+static_assert(std::same_as<std::iterator_traits<random_access<int>>::iterator_concept, std::random_access_iterator_tag>);
+static_assert(std::same_as<std::iterator_traits<random_access<int>>::pointer, int *>);
+static_assert(std::same_as<std::iter_value_t<random_access<int const>>, int>);
+
+static_assert(std::contiguous_iterator<contiguous<int>>);
+static_assert(std::contiguous_iterator<contiguous<int const>>);
+static_assert(std::same_as<std::iterator_traits<contiguous<int>>::iterator_category, std::random_access_iterator_tag>);
+
+static_assert(std::random_access_iterator<counting>);
+static_assert(!std::contiguous_iterator<counting>);
+static_assert(std::same_as<std::iterator_traits<counting>::iterator_category, std::input_iterator_tag>);
+static_assert(std::same_as<std::iterator_traits<counting>::pointer, void>);
+
+constexpr auto check_operators() -> bool {
+	int array[] = {0, 1, 2, 3, 4};
+	auto it = contiguous(array);
+	auto const last = contiguous(array + 5);
+	++it;
+	it += 2;
+	--it;
+	auto const previous = it--;
+	return
+		*it == 1 and
+		*previous == 2 and
+		it[2] == 3 and
+		*(2 + it) == 3 and
+		*(last - 1) == 4 and
+		last - it == 4 and
+		it < last and
+		it != last and
+		it == contiguous(array + 1) and
+		it.operator->() == array + 1 and
+		std::to_address(last) == array + 5;
+}
+static_assert(check_operators());
+
+constexpr auto check_algorithms() -> bool {
+	int source[] = {3, 1, 2};
+	int target[3] = {};
+	auto const span = std::span(contiguous(source), contiguous(source + 3));
+	std::ranges::copy(random_access(source), random_access(source + 3), contiguous(target));
+	std::ranges::sort(contiguous(target), contiguous(target + 3));
+	return
+		span.data() == source and
+		std::ranges::equal(target, std::array{1, 2, 3}) and
+		std::ranges::equal(std::ranges::subrange(counting(2), counting(5)), std::array{2, 3, 4});
+}
+static_assert(check_algorithms());
+
+} // namespace
@@ -0,0 +1,41 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module operators.negated;
+
+import std_module;
+
+namespace operators_impl::negated {
+
+template<typename T>
+struct impl {
+	T value;
+};
+
+} // namespace operators_impl::negated
+
+namespace operators {
+
+// The negation of `value`, left for whoever receives it to compute. The
+// generated `lhs - rhs` is `lhs + operators::negated<decltype(rhs) const &>{rhs}`
+// if a type accepts that, so a type that would otherwise allocate or make
+// another pass over memory to negate `rhs` can subtract directly instead. Like
+// `operators::constant`, it is defined outside of `operators` so that
+// argument-dependent lookup does not find the namespace-scope operators.
+export template<typename T>
+using negated = operators_impl::negated::impl<T>;
+
+} // namespace operators
+
+namespace {
+
+constexpr auto refers_to_value() -> bool {
+	auto const value = 5;
+	auto const result = operators::negated<int const &>{value};
+	return std::addressof(result.value) == std::addressof(value);
+}
+static_assert(refers_to_value());
+
+} // namespace
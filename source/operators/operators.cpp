@@ -10,6 +10,14 @@ export import operators.arrow_star;
 export import operators.binary_minus;
 export import operators.bracket;
 export import operators.compound_assignment;
+export import operators.constant;
+export import operators.elementwise;
+export import operators.expression;
 export import operators.increment_decrement;
+#if defined(OPERATORS_INSTRUMENT)
+export import operators.instrument;
+#endif
+export import operators.iterator_facade;
+export import operators.negated;
 export import operators.unary_minus;
 export import operators.unary_plus;
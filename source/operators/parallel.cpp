@@ -0,0 +1,286 @@
+// Copyright David Stone 2026.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+export module operators.parallel;
+
+import operators.compound_assignment;
+import std_module;
+
+// Not proposed for standardization
+
+namespace operators {
+
+// Runs `parallel_apply` on the calling thread and `count - 1` others. Each
+// thread claims the next unclaimed chunk until none are left, so a thread that
+// is slowed down by something else on the machine does less of the work.
+export struct threads {
+	constexpr explicit threads(std::size_t const count_):
+		count(count_ == 0 ? 1 : count_)
+	{
+	}
+	static auto hardware() -> threads {
+		return threads(std::thread::hardware_concurrency());
+	}
+
+	std::size_t count;
+};
+
+} // namespace operators
+
+namespace operators::detail {
+
+// Chunks start on a cache line boundary of `lhs` where possible, so two threads
+// never write to the same cache line. The value is fixed rather than
+// `std::hardware_destructive_interference_size` so that it does not change the
+// interface of this module between compiler flags.
+inline constexpr auto cache_line = std::size_t(64);
+inline constexpr auto chunk_bytes = std::size_t(64) * 1024;
+
+template<typename T>
+inline constexpr auto chunk_elements = chunk_bytes / sizeof(T) == 0 ? std::size_t(1) : chunk_bytes / sizeof(T);
+
+// `size` elements split into a first chunk of `first` elements, which ends on a
+// cache line boundary, followed by chunks of `chunk` elements.
+struct chunking {
+	constexpr auto count() const -> std::size_t {
+		if (size == 0) {
+			return 0;
+		}
+		return size <= first ? 1 : 1 + (size - first + chunk - 1) / chunk;
+	}
+	constexpr auto begin(std::size_t const index) const -> std::size_t {
+		return index == 0 ? 0 : std::min(size, first + (index - 1) * chunk);
+	}
+	constexpr auto end(std::size_t const index) const -> std::size_t {
+		return begin(index + 1);
+	}
+
+	std::size_t size;
+	std::size_t first;
+	std::size_t chunk;
+};
+
+template<typename Range>
+auto make_chunking(Range & range) -> chunking {
+	using value_type = std::ranges::range_value_t<Range>;
+	auto const size = static_cast<std::size_t>(std::ranges::size(range));
+	constexpr auto chunk = chunk_elements<value_type>;
+	if constexpr (std::ranges::contiguous_range<Range> and cache_line % sizeof(value_type) == 0) {
+		auto const address = reinterpret_cast<std::uintptr_t>(std::ranges::data(range));
+		auto const leading = (cache_line - address % cache_line) % cache_line / sizeof(value_type);
+		return chunking{size, leading == 0 ? chunk : leading, chunk};
+	} else {
+		return chunking{size, chunk, chunk};
+	}
+}
+
+constexpr auto apply_range(auto const & operation, auto const lhs, auto const rhs, std::size_t const first, std::size_t const last) -> void {
+	for (auto index = first; index != last; ++index) {
+		std::invoke(
+			operation,
+			lhs[static_cast<std::iter_difference_t<decltype(lhs)>>(index)],
+			rhs[static_cast<std::iter_difference_t<decltype(rhs)>>(index)]
+		);
+	}
+}
+
+template<typename Policy>
+concept standard_policy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+auto apply_chunks(chunking const chunks, auto const & apply_chunk, threads const policy) -> void {
+	auto next = std::atomic<std::size_t>(0);
+	auto const work = [&] {
+		for (auto index = next.fetch_add(1); index < chunks.count(); index = next.fetch_add(1)) {
+			apply_chunk(index);
+		}
+	};
+	auto const thread_count = std::min(policy.count, chunks.count());
+	auto pool = std::vector<std::jthread>();
+	for (std::size_t thread = 1; thread < thread_count; ++thread) {
+		pool.emplace_back(work);
+	}
+	work();
+}
+
+auto apply_chunks(chunking const chunks, auto const & apply_chunk, standard_policy auto && policy) -> void {
+	auto indices = std::vector<std::size_t>(chunks.count());
+	std::iota(indices.begin(), indices.end(), std::size_t(0));
+	std::for_each(policy, indices.begin(), indices.end(), apply_chunk);
+}
+
+// How `parallel_reduce` may change the order in which it combines values
+enum class reduction {
+	// Every element in order, on the calling thread
+	in_order,
+	// Each chunk in order, concurrently, and then the result of each chunk in
+	// order. This regroups the operations, so it requires associativity.
+	chunked,
+	// All of the elements with `std::reduce`, which may also reorder them, so it
+	// requires commutativity as well.
+	reordered,
+};
+
+template<typename Operation, typename T, typename Reference>
+inline constexpr auto reduction_for =
+	!::operators::is_associative<Operation> or
+	!std::constructible_from<T, Reference> or
+	!std::invocable<Operation const &, T, T> ? reduction::in_order :
+	!::operators::is_commutative<Operation> ? reduction::chunked :
+	reduction::reordered;
+
+constexpr auto reduce_range(auto const & operation, auto const first, std::size_t const begin, std::size_t const end, auto result) {
+	for (auto index = begin; index != end; ++index) {
+		result = std::invoke(operation, std::move(result), first[static_cast<std::iter_difference_t<decltype(first)>>(index)]);
+	}
+	return result;
+}
+
+} // namespace operators::detail
+
+namespace operators {
+
+export template<typename Policy>
+concept parallel_policy =
+	std::same_as<std::remove_cvref_t<Policy>, threads> or
+	::operators::detail::standard_policy<Policy>;
+
+// Calls `operation(lhs[index], rhs[index])` for each element of `lhs`, which is
+// usually a generated compound assignment operator: `rhs` must have at least as
+// many elements. The work is split into chunks of about 64 KiB of `lhs` that
+// are handed out under `policy`: either `operators::threads` or a standard
+// execution policy. A standard policy runs in parallel only if the standard
+// library has a parallel backend, which for libstdc++ is TBB. The calls for
+// different elements may run concurrently and in any order, and if `operation`
+// throws, `std::terminate` is called.
+//
+// During constant evaluation, this runs each operation in order.
+export template<typename Operation, std::ranges::random_access_range LHS, std::ranges::random_access_range RHS>
+	requires std::ranges::sized_range<LHS> and std::invocable<Operation const &, std::ranges::range_reference_t<LHS>, std::ranges::range_reference_t<RHS>>
+constexpr auto parallel_apply(Operation const & operation, LHS && lhs, RHS && rhs, parallel_policy auto && policy) -> void {
+	auto const lhs_first = std::ranges::begin(lhs);
+	auto const rhs_first = std::ranges::begin(rhs);
+	if consteval {
+		::operators::detail::apply_range(operation, lhs_first, rhs_first, 0, static_cast<std::size_t>(std::ranges::size(lhs)));
+	} else {
+		auto const chunks = ::operators::detail::make_chunking(lhs);
+		auto const apply_chunk = [&](std::size_t const index) noexcept {
+			::operators::detail::apply_range(operation, lhs_first, rhs_first, chunks.begin(index), chunks.end(index));
+		};
+		::operators::detail::apply_chunks(chunks, apply_chunk, policy);
+	}
+}
+
+// Returns `init` combined with each element of `range` in turn by
+// `operation(result, element)`. `operators::is_associative` and
+// `operators::is_commutative` of `Operation` decide what runs under `policy`:
+//
+// * Neither: the elements are combined in order on the calling thread.
+// * Associative: the chunks of `range`, as in `parallel_apply`, are reduced
+//   concurrently, starting from their first element, and their results are
+//   then combined with `init` in order. This also requires `T` to be
+//   constructible from an element and `operation(T, T)`.
+// * Also commutative: under a standard execution policy, the range is passed
+//   to `std::reduce`, which may combine the elements in any order.
+//
+// If `operation` throws while chunks are being reduced, `std::terminate` is
+// called. During constant evaluation, this combines the elements in order.
+export template<typename Operation, std::ranges::random_access_range Range, std::movable T>
+	requires std::ranges::sized_range<Range> and std::convertible_to<std::invoke_result_t<Operation const &, T, std::ranges::range_reference_t<Range>>, T>
+constexpr auto parallel_reduce(Operation const & operation, Range && range, T init, parallel_policy auto && policy) -> T {
+	using ::operators::detail::reduction;
+	constexpr auto strategy = ::operators::detail::reduction_for<Operation, T, std::ranges::range_reference_t<Range>>;
+	auto const first = std::ranges::begin(range);
+	auto const size = static_cast<std::size_t>(std::ranges::size(range));
+	if consteval {
+		return ::operators::detail::reduce_range(operation, first, 0, size, std::move(init));
+	} else {
+		if constexpr (strategy == reduction::in_order) {
+			return ::operators::detail::reduce_range(operation, first, 0, size, std::move(init));
+		} else if constexpr (strategy == reduction::reordered and ::operators::detail::standard_policy<decltype(policy)> and std::ranges::common_range<Range>) {
+			return std::reduce(policy, first, std::ranges::end(range), std::move(init), operation);
+		} else {
+			auto const chunks = ::operators::detail::make_chunking(range);
+			auto results = std::vector<std::optional<T>>(chunks.count());
+			auto const reduce_chunk = [&](std::size_t const index) noexcept {
+				auto const begin = chunks.begin(index);
+				results[index].emplace(::operators::detail::reduce_range(
+					operation,
+					first,
+					begin + 1,
+					chunks.end(index),
+					T(first[static_cast<std::iter_difference_t<decltype(first)>>(begin)])
+				));
+			};
+			::operators::detail::apply_chunks(chunks, reduce_chunk, policy);
+			for (auto & result : results) {
+				init = std::invoke(operation, std::move(init), std::move(*result));
+			}
+			return init;
+		}
+	}
+}
+
+} // namespace operators
+
+namespace {
+
+// Associative, but not commutative
+struct first_nonzero {
+	constexpr auto operator()(int const lhs, int const rhs) const -> int {
+		return lhs != 0 ? lhs : rhs;
+	}
+};
+
+} // namespace
+
+template<>
+inline constexpr auto operators::is_associative<first_nonzero> = true;
+
+namespace {
+
+using operators::detail::chunking;
+
+static_assert(chunking{0, 16, 16}.count() == 0);
+static_assert(chunking{10, 16, 16}.count() == 1);
+static_assert(chunking{16, 16, 16}.count() == 1);
+static_assert(chunking{17, 16, 16}.count() == 2);
+static_assert(chunking{40, 4, 16}.count() == 4);
+static_assert(chunking{40, 4, 16}.begin(1) == 4);
+static_assert(chunking{40, 4, 16}.begin(2) == 20);
+static_assert(chunking{40, 4, 16}.end(3) == 40);
+static_assert(chunking{2, 4, 16}.end(0) == 2);
+
+static_assert(operators::threads(0).count == 1);
+static_assert(operators::parallel_policy<operators::threads>);
+static_assert(operators::parallel_policy<std::execution::parallel_unsequenced_policy const &>);
+static_assert(!operators::parallel_policy<int>);
+
+constexpr auto applies_each_element() -> bool {
+	auto lhs = std::array{1, 2, 3, 4};
+	auto const rhs = std::array{10, 20, 30, 40};
+	operators::parallel_apply([](int & a, int const b) { a += b; }, lhs, rhs, operators::threads(4));
+	operators::parallel_apply([](int & a, int const b) { a -= b / 10; }, lhs, rhs, std::execution::par_unseq);
+	return lhs == std::array{10, 20, 30, 40};
+}
+static_assert(applies_each_element());
+
+using operators::detail::reduction;
+using operators::detail::reduction_for;
+
+static_assert(reduction_for<std::plus<>, int, int const &> == reduction::reordered);
+static_assert(reduction_for<first_nonzero, int, int const &> == reduction::chunked);
+static_assert(reduction_for<std::minus<>, int, int const &> == reduction::in_order);
+static_assert(reduction_for<operators::plus_equal_fn, int, int &> == reduction::in_order);
+
+constexpr auto reduces() -> bool {
+	auto const numbers = std::array{0, 0, 3, 4};
+	return
+		operators::parallel_reduce(std::plus<>(), numbers, 10, operators::threads(4)) == 17 and
+		operators::parallel_reduce(std::minus<>(), numbers, 10, std::execution::par) == 3 and
+		operators::parallel_reduce(first_nonzero(), numbers, 0, std::execution::par_unseq) == 3;
+}
+static_assert(reduces());
+
+} // namespace
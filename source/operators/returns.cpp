@@ -34,4 +34,40 @@ auto ref(auto && r) OPERATORS_RETURNS(
 
 static_assert(std::same_as<decltype(ref(move_only())), move_only &&>);
 
-} // namespace
\ No newline at end of file
+struct throwing_move {
+	throwing_move() = default;
+	throwing_move(throwing_move &&) noexcept(false) {
+	}
+};
+
+auto noexcept_parameter(auto x) OPERATORS_RETURNS_NOEXCEPT(
+	x
+)
+
+static_assert(std::same_as<decltype(noexcept_parameter(move_only())), move_only>);
+static_assert(noexcept(noexcept_parameter(5)));
+static_assert(noexcept(noexcept_parameter(move_only())));
+static_assert(!noexcept(noexcept_parameter(throwing_move())));
+
+auto noexcept_prvalue() OPERATORS_RETURNS_NOEXCEPT(
+	throwing_move()
+)
+
+static_assert(std::same_as<decltype(noexcept_prvalue()), throwing_move>);
+static_assert(noexcept(noexcept_prvalue()));
+
+auto noexcept_ref(auto && r) OPERATORS_RETURNS_NOEXCEPT(
+	r
+)
+
+static_assert(std::same_as<decltype(noexcept_ref(throwing_move())), throwing_move &&>);
+static_assert(noexcept(noexcept_ref(throwing_move())));
+
+auto noexcept_construct(auto && r) OPERATORS_RETURNS_NOEXCEPT(
+	std::remove_cvref_t<decltype(r)>(std::move(r))
+)
+
+static_assert(noexcept(noexcept_construct(move_only())));
+static_assert(!noexcept(noexcept_construct(throwing_move())));
+
+} // namespace
@@ -5,7 +5,9 @@
 
 module;
 
+#include <operators/force_inline.hpp>
 #include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 export module operators.unary_minus;
@@ -16,9 +18,51 @@ import std_module;
 
 // Not proposed for standardization
 
+namespace operators::detail {
+
+// In order of preference, `-value` is
+//
+// * `negate_in_place(value)` followed by returning `value`, if `value` is a
+//   non-const rvalue. This reuses the storage of `value`.
+// * `negate(value)`, which lets a type flip a sign rather than subtract
+// * `0 - value`
+//
+// The customizations are found by argument-dependent lookup. When
+// instrumented, returning the negated rvalue is counted as a move.
+
+template<typename T>
+concept negatable_in_place =
+	!std::is_reference_v<T> and
+	!std::is_const_v<T> and
+	requires(T & value) { negate_in_place(value); };
+
+template<typename T>
+concept negatable = requires(T && value) { negate(OPERATORS_FORWARD(value)); };
+
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto unary_minus(auto && value) OPERATORS_RETURNS_NOEXCEPT(
+	0 - OPERATORS_FORWARD(value)
+)
+
+template<typename T> requires(negatable<T> and !negatable_in_place<T>)
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto unary_minus(T && value) OPERATORS_RETURNS_NOEXCEPT(
+	negate(OPERATORS_FORWARD(value))
+)
+
+template<negatable_in_place T>
+OPERATORS_DETAIL_FORCE_INLINE constexpr auto unary_minus(T && value)
+	noexcept(noexcept(negate_in_place(value)) and std::is_nothrow_move_constructible_v<T>)
+	-> T
+{
+	negate_in_place(value);
+	OPERATORS_DETAIL_RECORD_MOVE(unary_minus);
+	return std::move(value);
+}
+
+} // namespace operators::detail
+
 #define OPERATORS_UNARY_MINUS_DEFINITION \
-	constexpr auto operator-(auto && value) OPERATORS_RETURNS( \
-		0 - OPERATORS_FORWARD(value) \
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator-(auto && value) OPERATORS_DETAIL_INSTRUMENTED_RETURNS_NOEXCEPT(unary_minus, \
+		::operators::detail::unary_minus(OPERATORS_FORWARD(value)) \
 	)
 
 namespace {
@@ -60,13 +104,14 @@ static_assert(0 - adl(3) == -3);
 static_assert(-adl(3) == -3);
 
 static_assert(!has_unary_plus<adl>);
+static_assert(!noexcept(-adl(3)));
 
 namespace n {
 
 using operators::unary::operator-;
 
 struct implicit {
-	friend constexpr auto operator-(int const lhs, implicit const rhs) {
+	friend constexpr auto operator-(int const lhs, implicit const rhs) noexcept {
 		return lhs - rhs.value;
 	}
 
@@ -81,7 +126,82 @@ static_assert(!has_unary_plus<implicit>);
 } // namespace n
 
 static_assert(-n::implicit{3} == -3);
+static_assert(noexcept(-n::implicit{3}));
 
 static_assert(!has_unary_plus<n::implicit>);
 
+template<typename T>
+concept has_unary_minus = requires(T value) { -OPERATORS_FORWARD(value); };
+
+struct negates : operators::unary::minus {
+	constexpr explicit negates(int value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto negate(negates const x) noexcept {
+		return negates(-x.value);
+	}
+
+	int value;
+};
+
+static_assert((-negates(3)).value == -3);
+static_assert(noexcept(-std::declval<negates const &>()));
+
+// Only an rvalue can be negated in place
+struct negates_in_place : operators::unary::minus {
+	constexpr explicit negates_in_place(int value_):
+		value(value_)
+	{
+	}
+	friend constexpr auto negate_in_place(negates_in_place & x) noexcept -> void {
+		x.value = -x.value;
+	}
+
+	int value;
+};
+
+static_assert((-negates_in_place(3)).value == -3);
+static_assert(std::same_as<decltype(-negates_in_place(3)), negates_in_place>);
+static_assert(noexcept(-std::declval<negates_in_place>()));
+static_assert(has_unary_minus<negates_in_place>);
+static_assert(!has_unary_minus<negates_in_place &>);
+static_assert(!has_unary_minus<negates_in_place const>);
+
+constexpr auto negate_in_place_moves_from_the_argument() -> bool {
+	auto value = negates_in_place(3);
+	auto const result = -std::move(value);
+	return result.value == -3;
+}
+static_assert(negate_in_place_moves_from_the_argument());
+
+// `negate_in_place` for rvalues, then `negate`, then `0 - value`
+struct prefers : operators::unary::minus {
+	prefers() = default;
+	constexpr explicit prefers(int chosen_):
+		chosen(chosen_)
+	{
+	}
+
+	friend constexpr auto negate_in_place(prefers & x) -> void {
+		x.chosen = 1;
+	}
+	friend constexpr auto negate(prefers const &) {
+		return prefers(2);
+	}
+	friend constexpr auto operator-(int, prefers const &) {
+		return prefers(3);
+	}
+
+	int chosen = 0;
+};
+
+constexpr auto chosen_for_lvalue() -> int {
+	auto const value = prefers();
+	return (-value).chosen;
+}
+
+static_assert((-prefers()).chosen == 1);
+static_assert(chosen_for_lvalue() == 2);
+
 } // namespace
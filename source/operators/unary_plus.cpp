@@ -5,6 +5,9 @@
 
 module;
 
+#include <operators/force_inline.hpp>
+#include <operators/forward.hpp>
+#include <operators/instrument.hpp>
 #include <operators/returns.hpp>
 
 export module operators.unary_plus;
@@ -13,10 +16,21 @@ import std_module;
 
 // Not proposed for standardization
 
+// The result is always a prvalue, constructed directly from the argument: a
+// single copy from an lvalue or a single move from an rvalue.
 #define OPERATORS_UNARY_PLUS_DEFINITION \
-	constexpr auto operator+(auto value) OPERATORS_RETURNS( \
-		value \
-	)
+	OPERATORS_DETAIL_FORCE_INLINE constexpr auto operator+(auto && value) \
+		noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<decltype(value)>, decltype(value)>) \
+		-> decltype(auto(OPERATORS_FORWARD(value))) \
+	{ \
+		OPERATORS_DETAIL_RECORD_CALL(unary_plus); \
+		if constexpr (std::is_lvalue_reference_v<decltype(value)>) { \
+			OPERATORS_DETAIL_RECORD_COPY(unary_plus); \
+		} else { \
+			OPERATORS_DETAIL_RECORD_MOVE(unary_plus); \
+		} \
+		return auto(OPERATORS_FORWARD(value)); \
+	}
 
 namespace operators_impl {
 
@@ -48,6 +62,67 @@ struct adl : private operators::unary::plus {
 
 static_assert((+adl{3}).value == 3);
 static_assert(!has_unary_minus<adl>);
+static_assert(noexcept(+std::declval<adl const &>()));
+
+struct throwing_copy : private operators::unary::plus {
+	throwing_copy() = default;
+	throwing_copy(throwing_copy const &) noexcept(false) {
+	}
+};
+
+static_assert(!noexcept(+std::declval<throwing_copy const &>()));
+
+static_assert(std::same_as<decltype(+std::declval<adl const &>()), adl>);
+static_assert(std::same_as<decltype(+std::declval<adl &&>()), adl>);
+
+struct counts_copies : private operators::unary::plus {
+	constexpr counts_copies(int & copies_, int & moves_):
+		copies(copies_),
+		moves(moves_)
+	{
+	}
+	constexpr counts_copies(counts_copies const & other):
+		copies(other.copies),
+		moves(other.moves)
+	{
+		++copies;
+	}
+	constexpr counts_copies(counts_copies && other) noexcept:
+		copies(other.copies),
+		moves(other.moves)
+	{
+		++moves;
+	}
+
+	int & copies;
+	int & moves;
+};
+
+// Returns copies * 10 + moves
+constexpr auto unary_plus_copies_and_moves(bool const from_lvalue) -> int {
+	auto copies = 0;
+	auto moves = 0;
+	auto value = counts_copies(copies, moves);
+	if (from_lvalue) {
+		static_cast<void>(+value);
+	} else {
+		static_cast<void>(+std::move(value));
+	}
+	return copies * 10 + moves;
+}
+static_assert(unary_plus_copies_and_moves(true) == 10);
+static_assert(unary_plus_copies_and_moves(false) == 1);
+
+struct move_only : private operators::unary::plus {
+	move_only() = default;
+	move_only(move_only &&) = default;
+};
+
+template<typename T>
+concept has_unary_plus = requires(T value) { +OPERATORS_FORWARD(value); };
+
+static_assert(has_unary_plus<move_only>);
+static_assert(!has_unary_plus<move_only &>);
 
 namespace n {
 